@@ -0,0 +1,104 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+
+#include "BenchmarkCustomizations.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <format>
+#include <string>
+#include <string_view>
+
+namespace wxUIBenchmarks {
+
+// Number of calls to the global operator new so far.  Defined in
+// wxUI_Benchmarks.cpp, which replaces the global allocation functions.
+auto allocationCount() -> std::uint64_t;
+
+// Runs each benchmark body repeatedly against a fresh BenchParent until
+// enough time has passed to give a stable figure, then reports the cost per
+// node.  A node is anything wxUI asked the parent to create (see
+// Counters::nodes()); the body declares how many it expects to create per
+// run, and the runner checks that it did.
+class Runner {
+public:
+    explicit Runner(std::string_view filter = {})
+        : filter_(filter)
+    {
+        std::puts(std::format("{:<48} {:>9} {:>9} {:>12} {:>14}", "benchmark", "nodes", "runs", "ns/node", "allocs/node").c_str());
+    }
+
+    template <typename Function>
+    void run(std::string_view name, std::size_t nodes, Function&& body)
+    {
+        if (!filter_.empty() && name.find(filter_) == std::string_view::npos) {
+            return;
+        }
+
+        // warm up, and make sure the body does what it says.
+        {
+            auto parent = BenchParent {};
+            body(parent);
+            if (parent.counters.nodes() != nodes) {
+                std::puts(std::format("{}: expected {} nodes, created {}", name, nodes, parent.counters.nodes()).c_str());
+                failed_ = true;
+                return;
+            }
+        }
+
+        auto runs = std::uint64_t { 0 };
+        auto allocations = std::uint64_t { 0 };
+        auto elapsed = std::chrono::nanoseconds {};
+        for (auto batch = std::uint64_t { 1 }; elapsed < kMinimumDuration; batch *= 2) {
+            auto const allocationsBefore = allocationCount();
+            auto const start = std::chrono::steady_clock::now();
+            for (auto i = std::uint64_t { 0 }; i < batch; ++i) {
+                auto parent = BenchParent {};
+                body(parent);
+            }
+            elapsed += std::chrono::steady_clock::now() - start;
+            allocations += allocationCount() - allocationsBefore;
+            runs += batch;
+        }
+
+        auto const totalNodes = static_cast<double>(runs * nodes);
+        std::puts(std::format("{:<48} {:>9} {:>9} {:>12.1f} {:>14.2f}", name, nodes, runs, static_cast<double>(elapsed.count()) / totalNodes, static_cast<double>(allocations) / totalNodes).c_str());
+    }
+
+    [[nodiscard]] auto failed() const { return failed_; }
+
+private:
+    static constexpr auto kMinimumDuration = std::chrono::milliseconds { 200 };
+    std::string filter_;
+    bool failed_ = false;
+};
+
+void controllerBenchmarks(Runner& runner);
+void forEachBenchmarks(Runner& runner);
+void layoutBenchmarks(Runner& runner);
+void menuBenchmarks(Runner& runner);
+
+}
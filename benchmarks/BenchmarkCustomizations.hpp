@@ -0,0 +1,264 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <variant>
+#include <wx/checkbox.h>
+#include <wx/font.h>
+#include <wx/sizer.h>
+#include <wx/string.h>
+#include <wxUI/Customizations.hpp>
+
+// The benchmarks plug into the same customization points as the unit tests
+// (see tests/TestCustomizations.hpp), but where TestParent records a
+// formatted log of every call, BenchParent only counts.  That keeps the
+// measurements about wxUI's own work: walking the description, converting
+// strings, binding events and proxies.
+//
+// Every "widget" created under a BenchParent is the BenchParent itself, and
+// every sizer/menu is one of its members, so the harness never allocates on
+// wxUI's behalf and the allocation counts are wxUI's alone.
+//
+// As with the tests, this header must be included before any wxUI
+// controller headers so the overloads below are visible to them.
+namespace wxUI::details {
+struct BindInfo;
+}
+
+namespace wxUIBenchmarks {
+
+struct BenchParent;
+
+struct Counters {
+    std::size_t windows {};
+    std::size_t sizers {};
+    std::size_t sizerItems {};
+    std::size_t menuBars {};
+    std::size_t menus {};
+    std::size_t menuItems {};
+    std::size_t binds {};
+    std::size_t proxies {};
+
+    // A node is anything wxUI asked to be created.
+    [[nodiscard]] auto nodes() const -> std::size_t
+    {
+        return windows + sizers + menuBars + menus + menuItems;
+    }
+};
+
+struct BenchSizer {
+    Counters* counters {};
+
+    void Add(BenchParent*, wxSizerFlags const&) { counters->sizerItems += 1; }
+    void Add(BenchSizer*, wxSizerFlags const&) { counters->sizerItems += 1; }
+    void AddSpacer(int) { counters->sizerItems += 1; }
+    void AddStretchSpacer(int) { counters->sizerItems += 1; }
+    void SetSizeHints(BenchParent*) { }
+};
+
+struct BenchMenuItem { };
+
+struct BenchMenu {
+    Counters* counters {};
+
+    void AppendSeparator() { counters->menuItems += 1; }
+};
+
+struct BenchMenuBar { };
+
+struct BenchParent {
+    BenchParent() = default;
+    BenchParent(BenchParent const&) = delete;
+    auto operator=(BenchParent const&) -> BenchParent& = delete;
+
+    Counters counters {};
+    BenchSizer sizer { &counters };
+    BenchMenu menu { &counters };
+    BenchMenuBar menuBar {};
+    BenchMenuItem menuItem {};
+
+    // The calls controllers make on a freshly created widget.
+    void SetSizer(BenchSizer*) { }
+    void SetSizerAndFit(BenchSizer*) { }
+    void AddPage(BenchParent*, wxString const&, bool) { }
+    void SetSelection(int) { }
+    void Select(size_t) { }
+    auto GetCount() const -> unsigned int { return 0; }
+    auto GetString(unsigned int) const -> wxString { return {}; }
+    void SetValue(bool) { }
+    void Set3StateValue(wxCheckBoxState) { }
+    void Wrap(int) { }
+    void Enable(bool) { }
+    void SetFont(wxFont const&) { }
+    void EnsureVisible(int) { }
+    void SetDefault() { }
+    void SetSashGravity(double) { }
+    void SplitVertically(BenchParent*, BenchParent*) { }
+    void SplitHorizontally(BenchParent*, BenchParent*) { }
+    template <typename Bitmap>
+    void SetBitmapPressed(Bitmap const&)
+    {
+    }
+    template <typename Bitmap>
+    void SetItemBitmap(unsigned int, Bitmap const&)
+    {
+    }
+};
+
+}
+
+namespace wxUI::customizations {
+
+template <typename Underlying, typename Parent>
+struct ParentCreateImpl;
+
+template <typename Underlying>
+struct ParentCreateImpl<Underlying, wxUIBenchmarks::BenchParent> {
+    template <typename... Args>
+    static auto create(wxUIBenchmarks::BenchParent* parent, Args&&...) -> wxUIBenchmarks::BenchParent*
+    {
+        parent->counters.windows += 1;
+        return parent;
+    }
+};
+
+inline auto SizerCreate(wxUIBenchmarks::BenchParent* parent, SizerInfo const&) -> wxUIBenchmarks::BenchSizer*
+{
+    parent->counters.sizers += 1;
+    return &parent->sizer;
+}
+
+inline void ControllerBindEvent(wxUIBenchmarks::BenchParent* controller, wxUI::details::BindInfo const&)
+{
+    controller->counters.binds += 1;
+}
+
+template <typename Dispatcher, typename BoundFunction>
+inline void ControllerDispatchEvent(wxUIBenchmarks::BenchParent* controller, Dispatcher& dispatcher, BoundFunction const& boundedFunction)
+{
+    boundedFunction.addTo(dispatcher, 0, controller);
+}
+
+template <typename Dispatcher>
+inline void ContainerBindDispatcher(wxUIBenchmarks::BenchParent* parent, std::shared_ptr<Dispatcher> dispatcher)
+{
+    // one handler per event type, and one for the controls' destroy events.
+    parent->counters.binds += dispatcher->eventTypes().size() + 1;
+}
+
+template <typename Proxy>
+inline void ControllerBindProxy(wxUIBenchmarks::BenchParent* controller, Proxy&)
+{
+    controller->counters.proxies += 1;
+}
+
+// The list never drops down here, so what would populate it is never run.
+inline void ControllerBindDropDown(wxUIBenchmarks::BenchParent* controller, std::function<void()>)
+{
+    controller->counters.binds += 1;
+}
+
+template <typename Proxy>
+inline void SizerBindProxy(wxUIBenchmarks::BenchSizer* sizer, Proxy&)
+{
+    sizer->counters->proxies += 1;
+}
+
+template <>
+struct MenuItemTypeFor<wxUIBenchmarks::BenchParent> {
+    using type = wxUIBenchmarks::BenchMenuItem;
+};
+
+inline auto MenuCreate(wxUIBenchmarks::BenchParent& parent) -> wxUIBenchmarks::BenchMenu*
+{
+    parent.counters.menus += 1;
+    return &parent.menu;
+}
+
+inline auto MenuBarCreate(wxUIBenchmarks::BenchParent* parent) -> wxUIBenchmarks::BenchMenuBar*
+{
+    parent->counters.menuBars += 1;
+    return &parent->menuBar;
+}
+
+inline auto MenuAppend(wxUIBenchmarks::BenchMenu* menu, int, wxString const&, wxString const&) -> wxUIBenchmarks::BenchMenuItem*
+{
+    menu->counters->menuItems += 1;
+    return nullptr;
+}
+
+inline auto MenuAppendCheckItem(wxUIBenchmarks::BenchMenu* menu, int, wxString const&, wxString const&) -> wxUIBenchmarks::BenchMenuItem*
+{
+    menu->counters->menuItems += 1;
+    return nullptr;
+}
+
+inline auto MenuAppendRadioItem(wxUIBenchmarks::BenchMenu* menu, int, wxString const&, wxString const&) -> wxUIBenchmarks::BenchMenuItem*
+{
+    menu->counters->menuItems += 1;
+    return nullptr;
+}
+
+inline void MenuBarAppend(wxUIBenchmarks::BenchMenuBar*, wxUIBenchmarks::BenchMenu*, wxString const&)
+{
+}
+
+inline void MenuAppendSubMenu(wxUIBenchmarks::BenchMenu*, wxUIBenchmarks::BenchMenu*, wxString const&)
+{
+}
+
+inline void MenuSetMenuBar(wxUIBenchmarks::BenchParent*, wxUIBenchmarks::BenchMenuBar*)
+{
+}
+
+inline void MenuBindToFrame(wxUIBenchmarks::BenchParent& frame, int, std::variant<std::function<void(wxCommandEvent&)>, std::function<void()>> const&)
+{
+    frame.counters.binds += 1;
+}
+
+template <typename Dispatcher>
+inline void MenuBindDispatcher(wxUIBenchmarks::BenchParent& frame, std::shared_ptr<Dispatcher const>)
+{
+    frame.counters.binds += 1;
+}
+
+template <typename Proxy>
+inline void MenuBindProxy(wxUIBenchmarks::BenchMenuItem*, Proxy&)
+{
+}
+
+template <typename Proxy>
+inline void MenuBindProxy(wxUIBenchmarks::BenchMenu* menu, Proxy&)
+{
+    menu->counters->proxies += 1;
+}
+
+template <typename Proxy>
+inline void MenuBindProxy(wxUIBenchmarks::BenchMenuBar*, Proxy&)
+{
+}
+
+}
@@ -0,0 +1,83 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+// One translation unit of the compile-time benchmark.  It is compiled once
+// per (depth, width) pair, set with WXUI_COMPILE_BENCHMARK_DEPTH and
+// WXUI_COMPILE_BENCHMARK_WIDTH, and what is measured is the compiler: how
+// long it takes, how much memory it needs and how big the object gets.
+// With WXUI_COMPILE_BENCHMARK_MODULE it imports the wxUI module instead.
+#include <wx/wx.h>
+#if defined(WXUI_COMPILE_BENCHMARK_MODULE)
+import wxUI;
+#else
+#include <wxUI/wxUI.hpp>
+#endif
+
+#include <cstddef>
+#include <utility>
+
+#if !defined(WXUI_COMPILE_BENCHMARK_DEPTH) || !defined(WXUI_COMPILE_BENCHMARK_WIDTH)
+#error "WXUI_COMPILE_BENCHMARK_DEPTH and WXUI_COMPILE_BENCHMARK_WIDTH must be defined"
+#endif
+
+namespace {
+
+// Cycle through a few kinds of controller so a row is not one repeated type.
+template <std::size_t Index>
+auto controller()
+{
+    if constexpr (Index % 3 == 0) {
+        return wxUI::Text { "Label" };
+    } else if constexpr (Index % 3 == 1) {
+        return wxUI::TextCtrl { "Value" };
+    } else {
+        return wxUI::Button { "Button" }.bind([] { });
+    }
+}
+
+// `Depth` levels of alternating VSizer/HSizer.  Each level lays out
+// `Width - 1` controllers and then the next level down, so the result is one
+// type that grows with both depth and width, the way a hand-written dialog
+// does.
+template <std::size_t Depth, std::size_t Width>
+auto layout()
+{
+    if constexpr (Depth == 0) {
+        return wxUI::Button { "Leaf" };
+    } else {
+        return []<std::size_t... Index>(std::index_sequence<Index...>) {
+            if constexpr (Depth % 2 == 0) {
+                return wxUI::HSizer { controller<Index>()..., layout<Depth - 1, Width>() };
+            } else {
+                return wxUI::VSizer { controller<Index>()..., layout<Depth - 1, Width>() };
+            }
+        }(std::make_index_sequence<Width - 1> {});
+    }
+}
+
+}
+
+void wxUICompileBenchmark(wxWindow* parent)
+{
+    layout<WXUI_COMPILE_BENCHMARK_DEPTH, WXUI_COMPILE_BENCHMARK_WIDTH>().fitTo(parent);
+}
@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+# Copyright (c) 2026 Richard Powell
+#
+# Records what it costs the compiler to build a wxUI layout.
+#
+# CMake runs every compile of wxUI_CompileBenchmark.cpp through this script as
+# a compiler launcher:
+#
+#   wxUI_CompileBenchmark.py measure <results dir> <variant> <depth> <width> -- <compiler command>
+#
+# which runs the compiler, then writes the wall time, the peak memory of the
+# compiler (including the processes the driver starts, such as cc1plus) and
+# the size of the object file to <results dir>/<variant>_d<depth>_w<width>.csv.
+# The variant is "headers" or "module", for how the layout uses wxUI.
+#
+#   wxUI_CompileBenchmark.py report <results dir>
+#
+# prints everything recorded so far as a table.
+
+import os
+import subprocess
+import sys
+import time
+
+
+def object_path(command):
+    for index, arg in enumerate(command):
+        if arg == "-o" and index + 1 < len(command):
+            return command[index + 1]
+        if arg.startswith("/Fo") or arg.startswith("-Fo"):
+            return arg[3:]
+    return None
+
+
+def run(command):
+    """Returns (exit code, seconds, peak memory in KiB or None)."""
+    start = time.perf_counter()
+    if not hasattr(os, "wait4"):
+        result = subprocess.run(command)
+        return result.returncode, time.perf_counter() - start, None
+    process = subprocess.Popen(command)
+    _, status, usage = os.wait4(process.pid, 0)
+    seconds = time.perf_counter() - start
+    # ru_maxrss is in KiB on Linux and in bytes on macOS.
+    peak = usage.ru_maxrss // 1024 if sys.platform == "darwin" else usage.ru_maxrss
+    return os.waitstatus_to_exitcode(status), seconds, peak
+
+
+def measure(results, variant, depth, width, command):
+    code, seconds, peak = run(command)
+    if code != 0:
+        return code
+    output = object_path(command)
+    size = os.path.getsize(output) if output and os.path.exists(output) else None
+    os.makedirs(results, exist_ok=True)
+    with open(os.path.join(results, f"{variant}_d{depth}_w{width}.csv"), "w") as file:
+        file.write(f"{variant},{depth},{width},{seconds:.3f},{'' if peak is None else peak},{'' if size is None else size}\n")
+    return 0
+
+
+def report(results):
+    rows = []
+    if os.path.isdir(results):
+        for name in os.listdir(results):
+            if name.endswith(".csv"):
+                with open(os.path.join(results, name)) as file:
+                    rows.append(file.read().strip().split(","))
+    if not rows:
+        print(f"No compile benchmarks recorded in {results}")
+        return 1
+    rows.sort(key=lambda row: (int(row[1]), int(row[2]), row[0]))
+    print(f"{'depth':>6} {'width':>6} {'nodes':>7} {'variant':>8} {'seconds':>8} {'peak MiB':>9} {'object KiB':>11}")
+    for variant, depth, width, seconds, peak, size in rows:
+        nodes = int(depth) * int(width) + 1
+        peak = f"{int(peak) / 1024:.1f}" if peak else "n/a"
+        size = f"{int(size) / 1024:.1f}" if size else "n/a"
+        print(f"{depth:>6} {width:>6} {nodes:>7} {variant:>8} {seconds:>8} {peak:>9} {size:>11}")
+    return 0
+
+
+def main(argv):
+    if len(argv) >= 7 and argv[1] == "measure" and argv[6] == "--":
+        return measure(argv[2], argv[3], argv[4], argv[5], argv[7:])
+    if len(argv) == 3 and argv[1] == "report":
+        return report(argv[2])
+    print("usage: wxUI_CompileBenchmark.py measure <results dir> <variant> <depth> <width> -- <command>\n"
+          "       wxUI_CompileBenchmark.py report <results dir>", file=sys.stderr)
+    return 2
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
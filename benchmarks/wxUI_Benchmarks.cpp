@@ -0,0 +1,209 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+// Headless benchmarks for building wxUI layouts.
+//
+// Usage: wxUI_Benchmarks [filter]
+//
+// Only benchmarks whose name contains `filter` are run.  Each line reports
+// the time and the number of heap allocations per created node, averaged
+// over as many runs as fit in a short time window.
+//
+// Like the unit tests, we bring up a full wxApp so that wx objects the
+// descriptions create along the way (strings, bitmaps, fonts) behave as
+// they would in an application, and run the benchmarks from OnRun().
+
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <wx/app.h>
+
+namespace {
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<std::uint64_t> gAllocations { 0 };
+}
+
+auto wxUIBenchmarks::allocationCount() -> std::uint64_t
+{
+    return gAllocations.load(std::memory_order_relaxed);
+}
+
+// Replacing the global allocation functions is the least intrusive way to
+// count what wxUI (and the wx objects it creates) allocate.  Every
+// replaceable form is covered, so nothing slips past the count through the
+// array, nothrow or over-aligned overloads.
+namespace {
+auto allocate(std::size_t size) -> void*
+{
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+auto allocate(std::size_t size, std::align_val_t alignment) -> void*
+{
+    gAllocations.fetch_add(1, std::memory_order_relaxed);
+    auto align = static_cast<std::size_t>(alignment);
+    // aligned_alloc wants the size to be a multiple of the alignment.
+    return std::aligned_alloc(align, (std::max<std::size_t>(size, 1) + align - 1) / align * align);
+}
+}
+
+auto operator new(std::size_t size) -> void*
+{
+    if (auto* ptr = allocate(size)) {
+        return ptr;
+    }
+    throw std::bad_alloc {};
+}
+
+auto operator new[](std::size_t size) -> void*
+{
+    return ::operator new(size);
+}
+
+auto operator new(std::size_t size, std::nothrow_t const&) noexcept -> void*
+{
+    return allocate(size);
+}
+
+auto operator new[](std::size_t size, std::nothrow_t const&) noexcept -> void*
+{
+    return allocate(size);
+}
+
+auto operator new(std::size_t size, std::align_val_t alignment) -> void*
+{
+    if (auto* ptr = allocate(size, alignment)) {
+        return ptr;
+    }
+    throw std::bad_alloc {};
+}
+
+auto operator new[](std::size_t size, std::align_val_t alignment) -> void*
+{
+    return ::operator new(size, alignment);
+}
+
+auto operator new(std::size_t size, std::align_val_t alignment, std::nothrow_t const&) noexcept -> void*
+{
+    return allocate(size, alignment);
+}
+
+auto operator new[](std::size_t size, std::align_val_t alignment, std::nothrow_t const&) noexcept -> void*
+{
+    return allocate(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::nothrow_t const&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::nothrow_t const&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t, std::nothrow_t const&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t, std::nothrow_t const&) noexcept
+{
+    std::free(ptr);
+}
+
+static int g_argc = 0;
+static char** g_argv = nullptr;
+
+class BenchmarkApp : public wxApp {
+public:
+    bool OnInit() override
+    {
+        return true;
+    }
+
+    int OnRun() override
+    {
+        auto runner = wxUIBenchmarks::Runner { g_argc > 1 ? g_argv[1] : "" };
+        wxUIBenchmarks::controllerBenchmarks(runner);
+        wxUIBenchmarks::layoutBenchmarks(runner);
+        wxUIBenchmarks::forEachBenchmarks(runner);
+        wxUIBenchmarks::menuBenchmarks(runner);
+        return runner.failed() ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+};
+
+wxIMPLEMENT_APP_NO_MAIN(BenchmarkApp);
+
+int main(int argc, char* argv[])
+{
+    g_argc = argc;
+    g_argv = argv;
+    wxApp::SetInstance(new BenchmarkApp());
+    return wxEntry(argc, argv);
+}
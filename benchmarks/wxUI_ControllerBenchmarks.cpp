@@ -0,0 +1,133 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include "Benchmark.hpp"
+
+#include <wxUI/wxUI.hpp>
+
+namespace {
+
+using wxUIBenchmarks::BenchParent;
+
+// Describe and create `kCount` controllers straight into the parent's sizer.
+// This is the per-controller cost every layout pays, with no sizer nesting.
+template <typename MakeController>
+void benchController(wxUIBenchmarks::Runner& runner, std::string_view name, MakeController make)
+{
+    constexpr auto kCount = std::size_t { 1'000 };
+    runner.run(std::format("createAndAdd/{}", name), kCount, [&make](BenchParent& parent) {
+        for (auto i = std::size_t { 0 }; i < kCount; ++i) {
+            make().createAndAdd(&parent, &parent.sizer, wxSizerFlags {});
+        }
+    });
+}
+
+}
+
+namespace wxUIBenchmarks {
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+void controllerBenchmarks(Runner& runner)
+{
+    auto const bitmap = wxBitmap { 16, 16 };
+
+    benchController(runner, "Bitmap", [&bitmap] { return wxUI::Bitmap { bitmap }; });
+    benchController(runner, "BitmapButton", [&bitmap] { return wxUI::BitmapButton { bitmap }; });
+    // The lookup a BitmapButton pays to share its icon through the cache.
+    benchController(runner, "BitmapButton from cache", [&bitmap] { return wxUI::BitmapButton { wxUI::BitmapCache::instance().get("icons/save.png", [&bitmap] { return bitmap; }) }; });
+    benchController(runner, "BitmapComboBox", [&bitmap] { return wxUI::BitmapComboBox { { { "one", bitmap }, { "two", bitmap }, { "three", bitmap } } }; });
+    benchController(runner, "BitmapToggleButton", [&bitmap] { return wxUI::BitmapToggleButton { bitmap }; });
+    benchController(runner, "Button", [] { return wxUI::Button { "Button" }; });
+    benchController(runner, "CheckBox", [] { return wxUI::CheckBox { "CheckBox" }; });
+    benchController(runner, "Choice", [] { return wxUI::Choice { { "one", "two", "three" } }.withSelection(1); });
+    benchController(runner, "ColorPickerCtrl", [] { return wxUI::ColorPickerCtrl {}; });
+    benchController(runner, "ComboBox", [] { return wxUI::ComboBox { "one", "two", "three" }.withSelection(1); });
+    benchController(runner, "Gauge", [] { return wxUI::Gauge {}; });
+    benchController(runner, "Hyperlink", [] { return wxUI::Hyperlink { "wxUI", "https://github.com/rmpowell77/wxUI" }; });
+    benchController(runner, "Line", [] { return wxUI::Line {}; });
+    benchController(runner, "ListBox", [] { return wxUI::ListBox { { "one", "two", "three" } }.withSelection(1); });
+    benchController(runner, "RadioBox", [] { return wxUI::RadioBox { wxUI::RadioBox::withChoices {}, "one", "two", "three" }; });
+    benchController(runner, "Slider", [] { return wxUI::Slider { { 0, 10 }, 5 }; });
+    benchController(runner, "SpinCtrl", [] { return wxUI::SpinCtrl { { 0, 10 }, 5 }; });
+    benchController(runner, "Text", [] { return wxUI::Text { "Text" }; });
+    benchController(runner, "TextCtrl", [] { return wxUI::TextCtrl { "TextCtrl" }; });
+
+    // The optional extras most controllers carry in real layouts.
+    benchController(runner, "Button+bind", [] { return wxUI::Button { "Button" }.bind([] { }); });
+    // Small handlers are stored inline in BindInfo, and the first one inline
+    // in the controller's extras.  The extras block is allocated by the first
+    // bind(), as by the first withSize(), so Button+bind costs that one
+    // allocation more than Button, and Button+size+bind costs no more than
+    // Button+size.  bind*4 adds the list holding the other handlers as it
+    // grows, and the Proxy.
+    benchController(runner, "Button+bind*4", [] {
+        auto proxy = wxUI::Button::Proxy {};
+        return wxUI::Button { "Button" }
+            .bind([] { })
+            .bind([proxy] { })
+            .bind([proxy](wxCommandEvent&) { })
+            .bind([proxy, count = 0] { });
+    });
+    benchController(runner, "Button+bind+copy", [] {
+        auto const description = wxUI::Button { "Button" }.bind([] { });
+        auto copy = description;
+        return copy;
+    });
+    benchController(runner, "Button+proxy", [] { return wxUI::Button { "Button" }.withProxy(wxUI::Button::Proxy {}); });
+    benchController(runner, "Button+font", [] { return wxUI::Button { "Button" }.withFont(wxFontInfo { 12 }); });
+    benchController(runner, "Button+size", [] { return wxUI::Button { "Button" }.withSize({ 100, 20 }).withPosition({ 1, 2 }); });
+    benchController(runner, "Button+size+bind", [] { return wxUI::Button { "Button" }.withSize({ 100, 20 }).withPosition({ 1, 2 }).bind([] { }); });
+
+    // One list with many rows; VirtualListBox only formats rows as they are drawn.
+    auto const rows = [] {
+        auto result = std::vector<std::string> {};
+        for (auto i = 0; i < 100'000; ++i) {
+            result.push_back(std::format("Row {}", i));
+        }
+        return result;
+    }();
+    runner.run("createAndAdd/ListBox+100000rows", 1, [&rows](BenchParent& parent) {
+        wxUI::ListBox { rows }.createAndAdd(&parent, &parent.sizer, wxSizerFlags {});
+    });
+    runner.run("createAndAdd/VirtualListBox+100000rows", 1, [&rows](BenchParent& parent) {
+        wxUI::VirtualListBox { rows }.createAndAdd(&parent, &parent.sizer, wxSizerFlags {});
+    });
+
+    // A picker with a bitmap per row, made up front or asked for when the
+    // list first drops down (which it never does here).
+    auto const names = std::vector<std::string>(rows.begin(), rows.begin() + 5'000);
+    auto iconOf = [](size_t) { return wxBitmapBundle { wxBitmap { 16, 16 } }; };
+    runner.run("createAndAdd/BitmapComboBox+5000rows", 1, [&names, &iconOf](BenchParent& parent) {
+        auto items = std::vector<std::tuple<wxString, wxBitmapBundle>> {};
+        for (auto i = 0UL; i < names.size(); ++i) {
+            items.emplace_back(wxString::FromUTF8(names[i]), iconOf(i));
+        }
+        wxUI::BitmapComboBox { items }.createAndAdd(&parent, &parent.sizer, wxSizerFlags {});
+    });
+    runner.run("createAndAdd/BitmapComboBox+5000rows from provider", 1, [&names, &iconOf](BenchParent& parent) {
+        wxUI::BitmapComboBox { names, iconOf }.createAndAdd(&parent, &parent.sizer, wxSizerFlags {});
+    });
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}
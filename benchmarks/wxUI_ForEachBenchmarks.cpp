@@ -0,0 +1,90 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include "Benchmark.hpp"
+
+#include <numeric>
+#include <string>
+#include <vector>
+#include <wxUI/wxUI.hpp>
+
+namespace wxUIBenchmarks {
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+void forEachBenchmarks(Runner& runner)
+{
+    for (auto count : { std::size_t { 100 }, std::size_t { 1'000 }, std::size_t { 10'000 }, std::size_t { 100'000 } }) {
+        auto indices = std::vector<int>(count);
+        std::iota(indices.begin(), indices.end(), 0);
+        auto labels = std::vector<std::string> {};
+        labels.reserve(count);
+        for (auto index : indices) {
+            labels.push_back("Item " + std::to_string(index));
+        }
+
+        // One VSizer plus one controller per item.
+        runner.run(std::format("fitTo/VForEach Button n={}", count), count + 1, [&indices](BenchParent& parent) {
+            wxUI::VForEach(indices, [](int) {
+                return wxUI::Button { "Button" };
+            }).fitTo(&parent);
+        });
+
+        // The same layout assembled at run time; with the buttons stored
+        // inline this is one allocation for the whole vector.
+        runner.run(std::format("build+fitTo/DynamicVSizer Button n={}", count), count + 1, [&indices](BenchParent& parent) {
+            auto layout = wxUI::DynamicVSizer<BenchParent, BenchSizer> {};
+            layout.reserve(indices.size());
+            for ([[maybe_unused]] auto index : indices) {
+                layout.add(wxUI::Button { "Button" });
+            }
+            layout.fitTo(&parent);
+        });
+
+        runner.run(std::format("fitTo/VForEach Text from std::string n={}", count), count + 1, [&labels](BenchParent& parent) {
+            wxUI::VForEach(labels, [](std::string const& label) {
+                return wxUI::Text { label };
+            }).fitTo(&parent);
+        });
+
+        runner.run(std::format("fitTo/VForEach Button+bind n={}", count), count + 1, [&indices](BenchParent& parent) {
+            wxUI::VForEach(indices, [](int index) {
+                return wxUI::Button { "Button" }.bind([index] { static_cast<void>(index); });
+            }).fitTo(&parent);
+        });
+
+        // The same handlers in one dispatcher on the parent; the VForEach
+        // adds its buttons straight into the outer VSizer.
+        runner.run(std::format("fitTo/VForEach Button+bind dispatcher n={}", count), count + 1, [&indices](BenchParent& parent) {
+            wxUI::VSizer {
+                wxUI::VForEach(indices, [](int index) {
+                    return wxUI::Button { "Button" }.bind([index] { static_cast<void>(index); });
+                }),
+            }
+                .withDispatcher()
+                .fitTo(&parent);
+        });
+    }
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}
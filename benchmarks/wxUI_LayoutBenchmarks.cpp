@@ -0,0 +1,145 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include "Benchmark.hpp"
+
+#include <wxUI/wxUI.hpp>
+
+namespace {
+
+using wxUIBenchmarks::BenchParent;
+
+// A chain of alternating VSizer/HSizer, `Depth` deep, with a single Button
+// at the bottom.  The whole chain is one type, so this also exercises how
+// deeply nested descriptions are moved into their parents.
+template <std::size_t Depth>
+auto nestedLayout()
+{
+    if constexpr (Depth == 0) {
+        return wxUI::Button { "Leaf" };
+    } else if constexpr (Depth % 2 == 0) {
+        return wxUI::HSizer { nestedLayout<Depth - 1>() };
+    } else {
+        return wxUI::VSizer { nestedLayout<Depth - 1>() };
+    }
+}
+
+template <std::size_t Depth>
+void benchNesting(wxUIBenchmarks::Runner& runner)
+{
+    // Depth sizers plus the leaf.
+    runner.run(std::format("fitTo/nested depth={}", Depth), Depth + 1, [](BenchParent& parent) {
+        nestedLayout<Depth>().fitTo(&parent);
+    });
+}
+
+// A typical form: rows of label, entry and button.
+auto formRow()
+{
+    return wxUI::HSizer {
+        wxUI::Text { "Label" },
+        wxUI::TextCtrl { "Value" },
+        wxUI::Button { "..." },
+    };
+}
+
+// The same form as data, for LayoutImage.
+auto form8RowsImage()
+{
+    using Kind = wxUI::LayoutImage::Kind;
+    auto form = wxUI::LayoutImage::Node { .kind = Kind::VSizer };
+    for (auto row = 0; row < 8; ++row) {
+        form.children.push_back({
+            .kind = Kind::HSizer,
+            .children = {
+                { .kind = Kind::Text, .text = "Label" },
+                { .kind = Kind::TextCtrl, .text = "Value" },
+                { .kind = Kind::Button, .text = "..." },
+            },
+        });
+    }
+    return wxUI::LayoutImage::serialize(form);
+}
+
+auto form8Rows()
+{
+    return wxUI::VSizer {
+        formRow(),
+        formRow(),
+        formRow(),
+        formRow(),
+        formRow(),
+        formRow(),
+        formRow(),
+        formRow(),
+    };
+}
+
+}
+
+namespace wxUIBenchmarks {
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+void layoutBenchmarks(Runner& runner)
+{
+    benchNesting<1>(runner);
+    benchNesting<4>(runner);
+    benchNesting<16>(runner);
+    benchNesting<64>(runner);
+
+    // 1 + 8 rows * (1 sizer + 3 controllers)
+    runner.run("fitTo/form 8 rows", 33, [](BenchParent& parent) {
+        form8Rows().fitTo(&parent);
+    });
+
+    // Descriptions are values; this is the cost of keeping one around.
+    runner.run("copy+fitTo/form 8 rows", 33, [](BenchParent& parent) {
+        auto const form = form8Rows();
+        auto copy = form;
+        copy.fitTo(&parent);
+    });
+
+    // Stamping the same description out again, without copying it.
+    runner.run("stamp+fitTo/form 8 rows", 33, [prototype = wxUI::Prototype { form8Rows() }](BenchParent& parent) {
+        prototype.stamp().fitTo(&parent);
+    });
+
+    // Checking the image and reading the records as it is built.
+    runner.run("fitTo/form 8 rows from image", 33, [bytes = form8RowsImage()](BenchParent& parent) {
+        wxUI::LayoutImage { bytes }.fitTo(&parent);
+    });
+
+    // 1 + 4 boxes * (1 captioned sizer + 4 controllers)
+    runner.run("fitTo/captioned boxes", 21, [](BenchParent& parent) {
+        wxUI::VSizer {
+            wxUI::VSizer { "Box", wxUI::CheckBox { "a" }, wxUI::CheckBox { "b" }, wxUI::CheckBox { "c" }, wxUI::CheckBox { "d" } },
+            wxUI::VSizer { "Box", wxUI::CheckBox { "a" }, wxUI::CheckBox { "b" }, wxUI::CheckBox { "c" }, wxUI::CheckBox { "d" } },
+            wxUI::VSizer { "Box", wxUI::CheckBox { "a" }, wxUI::CheckBox { "b" }, wxUI::CheckBox { "c" }, wxUI::CheckBox { "d" } },
+            wxUI::VSizer { "Box", wxUI::CheckBox { "a" }, wxUI::CheckBox { "b" }, wxUI::CheckBox { "c" }, wxUI::CheckBox { "d" } },
+        }
+            .fitTo(&parent);
+    });
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}
@@ -0,0 +1,188 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include "Benchmark.hpp"
+
+#include <ranges>
+#include <string>
+#include <vector>
+#include <wxUI/Literal.hpp>
+#include <wxUI/Menu.hpp>
+
+namespace {
+
+using wxUIBenchmarks::BenchParent;
+
+auto itemsMenu(std::string_view name, std::vector<std::string> const& labels)
+{
+    return wxUI::Menu {
+        name,
+        wxUI::MenuForEach { std::ranges::ref_view(labels), [](std::string const& label) {
+                               return wxUI::Item { label, [] { } };
+                           } },
+    };
+}
+
+// A fixed edit menu, as rebuilt each time a context menu opens.
+auto editMenu()
+{
+    return wxUI::Menu {
+        "Edit",
+        wxUI::Item { "&Undo", "Undo the last change", [] { } },
+        wxUI::Item { "&Redo", "Redo the last change", [] { } },
+        wxUI::Item { "Cu&t", "Cut the selection", [] { } },
+        wxUI::Item { "&Copy", "Copy the selection", [] { } },
+        wxUI::Item { "&Paste", "Paste from the clipboard", [] { } },
+        wxUI::Item { "&Delete", "Delete the selection", [] { } },
+        wxUI::Item { "Select &All", "Select everything", [] { } },
+        wxUI::Item { "&Find...", "Find text", [] { } },
+    };
+}
+
+// Nested menus written out item by item, so each level of the description
+// is handed to the next as a temporary: 4 menus x 10 submenus x 5 submenus x
+// 10 items.
+auto tenItems(std::string_view name)
+{
+    return wxUI::Menu {
+        name,
+        wxUI::Item { "Item 0", "Help for item 0", [] { } },
+        wxUI::Item { "Item 1", "Help for item 1", [] { } },
+        wxUI::Item { "Item 2", "Help for item 2", [] { } },
+        wxUI::Item { "Item 3", "Help for item 3", [] { } },
+        wxUI::Item { "Item 4", "Help for item 4", [] { } },
+        wxUI::Item { "Item 5", "Help for item 5", [] { } },
+        wxUI::Item { "Item 6", "Help for item 6", [] { } },
+        wxUI::Item { "Item 7", "Help for item 7", [] { } },
+        wxUI::Item { "Item 8", "Help for item 8", [] { } },
+        wxUI::Item { "Item 9", "Help for item 9", [] { } },
+    };
+}
+
+auto fiftyItems(std::string_view name)
+{
+    return wxUI::Menu { name, tenItems("A"), tenItems("B"), tenItems("C"), tenItems("D"), tenItems("E") };
+}
+
+auto fiveHundredItems(std::string_view name)
+{
+    return wxUI::Menu {
+        name,
+        fiftyItems("0"),
+        fiftyItems("1"),
+        fiftyItems("2"),
+        fiftyItems("3"),
+        fiftyItems("4"),
+        fiftyItems("5"),
+        fiftyItems("6"),
+        fiftyItems("7"),
+        fiftyItems("8"),
+        fiftyItems("9"),
+    };
+}
+
+auto editMenuLiterals()
+{
+    using namespace wxUI::literals;
+    using wxUI::wxUI_String;
+    return wxUI::Menu {
+        wxUI_String {},
+        "Edit"_wx,
+        wxUI::Item { wxUI_String {}, "&Undo"_wx, "Undo the last change"_wx, [] { } },
+        wxUI::Item { wxUI_String {}, "&Redo"_wx, "Redo the last change"_wx, [] { } },
+        wxUI::Item { wxUI_String {}, "Cu&t"_wx, "Cut the selection"_wx, [] { } },
+        wxUI::Item { wxUI_String {}, "&Copy"_wx, "Copy the selection"_wx, [] { } },
+        wxUI::Item { wxUI_String {}, "&Paste"_wx, "Paste from the clipboard"_wx, [] { } },
+        wxUI::Item { wxUI_String {}, "&Delete"_wx, "Delete the selection"_wx, [] { } },
+        wxUI::Item { wxUI_String {}, "Select &All"_wx, "Select everything"_wx, [] { } },
+        wxUI::Item { wxUI_String {}, "&Find..."_wx, "Find text"_wx, [] { } },
+    };
+}
+
+}
+
+namespace wxUIBenchmarks {
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+void menuBenchmarks(Runner& runner)
+{
+    // Four menus sharing the items evenly, as an application with a large
+    // command set (recent files, plugins, scripts) would have.
+    constexpr auto kMenus = std::size_t { 4 };
+    for (auto count : { std::size_t { 100 }, std::size_t { 1'000 }, std::size_t { 2'000 }, std::size_t { 5'000 } }) {
+        auto labels = std::vector<std::string> {};
+        for (auto i = std::size_t { 0 }; i < count / kMenus; ++i) {
+            labels.push_back("Command " + std::to_string(i));
+        }
+
+        // The menu bar, each menu, and each item.
+        runner.run(std::format("fitTo/MenuBar items={}", count), 1 + kMenus + count, [&labels](BenchParent& parent) {
+            wxUI::MenuBar {
+                itemsMenu("File", labels),
+                itemsMenu("Edit", labels),
+                itemsMenu("View", labels),
+                itemsMenu("Tools", labels),
+            }
+                .fitTo(&parent);
+        });
+
+        // The same, with the handlers in one dispatcher rather than each
+        // bound to the frame.  Binding costs nothing here, so this is the
+        // cost of filling the dispatcher's table.
+        runner.run(std::format("fitTo/MenuBar dispatcher items={}", count), 1 + kMenus + count, [&labels](BenchParent& parent) {
+            wxUI::MenuBar {
+                itemsMenu("File", labels),
+                itemsMenu("Edit", labels),
+                itemsMenu("View", labels),
+                itemsMenu("Tools", labels),
+            }
+                .withDispatcher()
+                .fitTo(&parent);
+        });
+    }
+
+    // A 2,000 item menu bar described in full each time, as a context menu
+    // regenerated on every right-click is: the menu bar, 4 + 40 + 200 menus
+    // and submenus, and the items.
+    runner.run("build+fitTo/MenuBar nested items=2000", 1 + 244 + 2'000, [](BenchParent& parent) {
+        wxUI::MenuBar {
+            fiveHundredItems("File"),
+            fiveHundredItems("Edit"),
+            fiveHundredItems("View"),
+            fiveHundredItems("Tools"),
+        }
+            .fitTo(&parent);
+    });
+
+    // The same menu with labels converted on every build, and with
+    // wxUI::Literal labels converted once.
+    runner.run("fitTo/MenuBar edit menu", 1 + 1 + 8, [](BenchParent& parent) {
+        wxUI::MenuBar { editMenu() }.fitTo(&parent);
+    });
+    runner.run("fitTo/MenuBar edit menu literals", 1 + 1 + 8, [](BenchParent& parent) {
+        wxUI::MenuBar { editMenuLiterals() }.fitTo(&parent);
+    });
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers)
+
+}
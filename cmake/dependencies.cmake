@@ -6,7 +6,7 @@ cmake_minimum_required(VERSION 3.23)
 # Option to use FetchContent for wxWidgets (for CI compatibility testing)
 option(WXUI_FETCH_WXWIDGETS "Use FetchContent to fetch wxWidgets instead of find_package" OFF)
 
-if (WXUI_WITH_TESTS OR WXUI_WITH_EXAMPLES)
+if (WXUI_WITH_TESTS OR WXUI_WITH_EXAMPLES OR WXUI_WITH_BENCHMARKS OR WXUI_WITH_MODULE)
   if (WXUI_FETCH_WXWIDGETS)
     include(FetchContent)
     
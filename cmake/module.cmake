@@ -0,0 +1,26 @@
+# module.cmake
+# builds the wxUI C++ module
+
+# wxUI_AddModule(<target> [CUSTOMIZATIONS <header>])
+#
+# Builds modules/wxUI.cppm as <target>, for `import wxUI;`.  wxUI finds its
+# customization points where its templates are defined, so overloads in
+# wxUI::customizations have to be part of the module to be seen.  The
+# CUSTOMIZATIONS header is included in the module ahead of the wxUI headers,
+# just as it would be included first by a translation unit using the headers.
+function(wxUI_AddModule target)
+  cmake_parse_arguments(PARSE_ARGV 1 arg "" "CUSTOMIZATIONS" "")
+  add_library(${target})
+  target_sources(${target}
+    PUBLIC
+    FILE_SET CXX_MODULES
+    BASE_DIRS ${CMAKE_CURRENT_FUNCTION_LIST_DIR}/../modules
+    FILES
+      ${CMAKE_CURRENT_FUNCTION_LIST_DIR}/../modules/wxUI.cppm
+  )
+  wxUI_SetupCompilerForTarget(${target})
+  target_link_libraries(${target} PUBLIC wxUI::wxUI wx::core)
+  if(arg_CUSTOMIZATIONS)
+    target_compile_definitions(${target} PRIVATE "WXUI_MODULE_CUSTOMIZATIONS=\"${arg_CUSTOMIZATIONS}\"")
+  endif()
+endfunction()
@@ -244,6 +244,13 @@ ForEachExample::ForEachExample(wxWindow* parent)
 {
     using namespace wxUI;
     using namespace std::literals;
+    auto keyedProxy = KeyedForEachProxy<std::string> {};
+    // snippet DynamicSizerExample
+    auto form = DynamicVSizer { "Form" };
+    for (auto const& field : std::vector<std::string> { "Name", "Address", "Phone" }) {
+        form.add(HSizer { Text { field }, TextCtrl {} });
+    }
+    // endsnippet DynamicSizerExample
     VSizer {
         wxSizerFlags {}.Border(wxALL, 2),
         HForEach(
@@ -347,6 +354,21 @@ ForEachExample::ForEachExample(wxWindow* parent)
             [](auto identity, auto name) {
                 return wxUI::Button { identity, name };
             }),
+        // snippet KeyedForEachExample
+        HSizer {
+            KeyedForEach {
+                std::vector<std::string> { "A", "B", "C" },
+                [](auto const& name) { return name; },
+                [](auto const& name) { return wxUI::Button { name }; } }
+                .withProxy(keyedProxy),
+        },
+        Button { "Rotate" }
+            .bind([keyedProxy, names = std::vector<std::string> { "A", "B", "C" }]() mutable {
+                std::ranges::rotate(names, names.begin() + 1);
+                keyedProxy.update(names);
+            }),
+        // endsnippet KeyedForEachExample
+        form,
         CreateStdDialogButtonSizer(wxOK),
     }
         .fitTo(this);
@@ -542,7 +564,7 @@ NotebookExample::NotebookExample(wxWindow* parent)
                 "Notebook",
                 Notebook {
                     BookItem { "Item 1", VSizer { Text { "Item 1" }.withSize({ 200, 50 }) } },
-                    BookItem { "Item 2", Text { "Item 2" }.withSize({ 200, 50 }) },
+                    BookItem { "Item 2", Text { "Item 2" }.withSize({ 200, 50 }) }.withLazy(),
                     LayoutIf {
                         true,
                         BookItem { "Optional", VSizer { Text { "Optional Item" }.withSize({ 200, 50 }) } },
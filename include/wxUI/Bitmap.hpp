@@ -26,6 +26,7 @@ SOFTWARE.
 #include <wxUI/Widget.hpp>
 #include <wxUI/detail/HelperMacros.hpp>
 
+#include <wx/bmpbndl.h>
 #include <wx/statbmp.h>
 
 namespace wxUI {
@@ -34,12 +35,12 @@ namespace wxUI {
 struct Bitmap {
     using underlying_t = wxStaticBitmap;
 
-    explicit Bitmap(wxBitmap const& bitmap)
+    explicit Bitmap(wxBitmapBundle const& bitmap)
         : Bitmap(wxID_ANY, bitmap)
     {
     }
 
-    Bitmap(wxWindowID identity, wxBitmap const& bitmap)
+    Bitmap(wxWindowID identity, wxBitmapBundle const& bitmap)
         : details_(identity)
         , bitmap_(bitmap)
     {
@@ -50,7 +51,7 @@ struct Bitmap {
 
 private:
     details::WidgetDetails<Bitmap, wxStaticBitmap> details_;
-    wxBitmap bitmap_;
+    wxBitmapBundle bitmap_;
 
     template <typename Parent>
     auto createImpl()
@@ -23,6 +23,7 @@ SOFTWARE.
 */
 #pragma once
 
+#include <wx/bmpbndl.h>
 #include <wx/bmpbuttn.h>
 #include <wxUI/Widget.hpp>
 
@@ -34,12 +35,12 @@ namespace wxUI {
 struct BitmapButton {
     using underlying_t = wxBitmapButton;
 
-    explicit BitmapButton(wxBitmap const& bitmap)
+    explicit BitmapButton(wxBitmapBundle const& bitmap)
         : BitmapButton(wxID_ANY, bitmap)
     {
     }
 
-    BitmapButton(wxWindowID identity, wxBitmap const& bitmap)
+    BitmapButton(wxWindowID identity, wxBitmapBundle const& bitmap)
         : details_(identity)
         , bitmap_(bitmap)
     {
@@ -76,7 +77,7 @@ struct BitmapButton {
 
 private:
     details::WidgetDetails<BitmapButton, wxBitmapButton> details_;
-    wxBitmap bitmap_;
+    wxBitmapBundle bitmap_;
     bool isDefault_ = false;
 
     template <typename Parent>
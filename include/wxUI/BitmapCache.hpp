@@ -0,0 +1,189 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <list>
+#include <map>
+#include <utility>
+#include <vector>
+#include <wx/app.h>
+#include <wx/bmpbndl.h>
+#include <wx/display.h>
+#include <wx/string.h>
+
+namespace wxUI {
+
+// BitmapCache decodes each image once and hands out the same wxBitmapBundle
+// every time it is asked for again, so the controllers of a panel full of
+// icons share one bundle per image rather than decoding the same file over
+// and over.  A bundle makes and keeps its scaled bitmaps for each DPI scale
+// it is shown at, so sharing it shares those too.
+//
+//     auto& icons = wxUI::BitmapCache::instance();
+//     wxUI::BitmapButton { icons.fromFiles("icons", "save") }
+//
+// Bundles are remembered by the key they are asked for with, until the
+// bitmaps they hold pass the memory limit; then the ones used longest ago
+// are forgotten first.  Each bundle is counted at four bytes a pixel for
+// every DPI scale in scales(), at the size it uses there: a variant it was
+// loaded with where one fits, otherwise the scaled bitmap it makes.  By
+// default the scales are 1 and those of the displays present when the cache
+// is first used.  Bundles handed out stay valid after they are forgotten.
+// The cache is shared by the whole process and is only used from the UI
+// thread.
+class BitmapCache {
+public:
+    static constexpr std::size_t kDefaultMemoryLimit = std::size_t { 64 } * 1024 * 1024;
+
+    static auto instance() -> BitmapCache&
+    {
+        static auto cache = BitmapCache {};
+        return cache;
+    }
+
+    // The bundle for `key`, calling `decode` to make it if it is not already
+    // remembered.  Bundles that are not ok are returned but not remembered.
+    template <typename Decode>
+    auto get(wxString const& key, Decode&& decode) -> wxBitmapBundle
+    {
+        if (auto found = index_.find(key); found != index_.end()) {
+            entries_.splice(entries_.begin(), entries_, found->second);
+            return found->second->bundle;
+        }
+        auto bundle = wxBitmapBundle { std::forward<Decode>(decode)() };
+        if (!bundle.IsOk()) {
+            return bundle;
+        }
+        auto bytes = bytesOf(bundle);
+        entries_.push_front({ key, bundle, bytes });
+        index_.emplace(key, entries_.begin());
+        memoryUsed_ += bytes;
+        evict();
+        return bundle;
+    }
+
+    // `filename`.`extension` in `path`, along with the variants for higher
+    // DPI scales next to it (see wxBitmapBundle::FromFiles).
+    auto fromFiles(wxString const& path, wxString const& filename, wxString const& extension = "png") -> wxBitmapBundle
+    {
+        return get(path + "/" + filename + "." + extension, [&] {
+            return wxBitmapBundle::FromFiles(path, filename, extension);
+        });
+    }
+
+    void setMemoryLimit(std::size_t bytes)
+    {
+        memoryLimit_ = bytes;
+        evict();
+    }
+
+    [[nodiscard]] auto memoryLimit() const { return memoryLimit_; }
+    // As counted against the limit, at each of scales().
+    [[nodiscard]] auto memoryUsed() const { return memoryUsed_; }
+
+    // The DPI scales the bundles are counted at.  Set them when the
+    // application moves to displays with other scales.
+    [[nodiscard]] auto scales() -> std::vector<double> const&
+    {
+        if (scales_.empty()) {
+            scales_ = displayScales();
+        }
+        return scales_;
+    }
+
+    void setScales(std::vector<double> scales)
+    {
+        scales_ = std::move(scales);
+        memoryUsed_ = 0;
+        for (auto& entry : entries_) {
+            entry.bytes = bytesOf(entry.bundle);
+            memoryUsed_ += entry.bytes;
+        }
+        evict();
+    }
+    [[nodiscard]] auto size() const { return entries_.size(); }
+
+    void clear()
+    {
+        index_.clear();
+        entries_.clear();
+        memoryUsed_ = 0;
+    }
+
+private:
+    struct Entry {
+        wxString key;
+        wxBitmapBundle bundle;
+        std::size_t bytes {};
+    };
+
+    // 1, and the scale of each display if there is an application to ask.
+    static auto displayScales() -> std::vector<double>
+    {
+        auto scales = std::vector<double> { 1.0 };
+        if (wxTheApp != nullptr) {
+            for (auto index = 0U; index < wxDisplay::GetCount(); ++index) {
+                scales.push_back(wxDisplay { index }.GetScaleFactor());
+            }
+        }
+        return scales;
+    }
+
+    // Scales that use the same bitmap count it once.
+    auto bytesOf(wxBitmapBundle const& bundle) -> std::size_t
+    {
+        auto sizes = std::vector<wxSize> {};
+        auto bytes = std::size_t {};
+        for (auto scale : scales()) {
+            auto size = bundle.GetPreferredBitmapSizeAtScale(scale);
+            if (std::ranges::find(sizes, size) == sizes.end()) {
+                sizes.push_back(size);
+                bytes += static_cast<std::size_t>(size.GetWidth()) * static_cast<std::size_t>(size.GetHeight()) * 4;
+            }
+        }
+        return bytes;
+    }
+
+    // Keeps the bundle asked for last, even if it is over the limit alone.
+    void evict()
+    {
+        while (memoryUsed_ > memoryLimit_ && entries_.size() > 1) {
+            auto& oldest = entries_.back();
+            memoryUsed_ -= oldest.bytes;
+            index_.erase(oldest.key);
+            entries_.pop_back();
+        }
+    }
+
+    // most recently used first
+    std::list<Entry> entries_ {};
+    std::map<wxString, std::list<Entry>::iterator> index_ {};
+    std::size_t memoryLimit_ { kDefaultMemoryLimit };
+    std::size_t memoryUsed_ {};
+    std::vector<double> scales_ {};
+};
+
+}
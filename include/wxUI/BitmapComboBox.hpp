@@ -23,10 +23,17 @@ SOFTWARE.
 */
 #pragma once
 
+#include <functional>
+#include <memory>
+#include <optional>
 #include <ranges>
+#include <vector>
+#include <wx/bmpbndl.h>
 #include <wx/bmpcbox.h>
+#include <wxUI/ChoiceList.hpp>
 #include <wxUI/GetterSetter.hpp>
 #include <wxUI/Widget.hpp>
+#include <wxUI/detail/ChoicesDetails.hpp>
 
 #include <wxUI/detail/HelperMacros.hpp>
 
@@ -36,12 +43,12 @@ namespace wxUI {
 struct BitmapComboBox {
     using underlying_t = wxBitmapComboBox;
 
-    explicit BitmapComboBox(std::initializer_list<std::tuple<std::string, wxBitmap>> bitmapChoices)
+    explicit BitmapComboBox(std::initializer_list<std::tuple<std::string, wxBitmapBundle>> bitmapChoices)
         : BitmapComboBox(wxID_ANY, bitmapChoices)
     {
     }
 
-    BitmapComboBox(wxWindowID identity, std::initializer_list<std::tuple<std::string, wxBitmap>> bitmapChoices)
+    BitmapComboBox(wxWindowID identity, std::initializer_list<std::tuple<std::string, wxBitmapBundle>> bitmapChoices)
         : details_(identity)
         , choices_([&bitmapChoices] {
             std::vector<wxString> result;
@@ -49,28 +56,60 @@ struct BitmapComboBox {
             for (auto&& [first, _] : bitmapChoices) {
                 result.push_back(wxString::FromUTF8(first));
             }
-            return result;
+            return ChoiceList { std::move(result) };
         }())
         , bitmaps_([&bitmapChoices] {
-            std::vector<wxBitmap> result;
+            std::vector<wxBitmapBundle> result;
             result.reserve(bitmapChoices.size());
             for (auto&& [_, second] : bitmapChoices) {
                 result.push_back(second);
             }
-            return result;
+            return std::make_shared<ItemBitmaps const>(ItemBitmaps { std::move(result), {} });
         }())
     {
     }
 
-    explicit BitmapComboBox(details::Ranges::input_range_of<std::tuple<wxString, wxBitmap>> auto&& choices)
+    explicit BitmapComboBox(details::Ranges::input_range_of<std::tuple<wxString, wxBitmapBundle>> auto&& choices)
         : BitmapComboBox(wxID_ANY, std::forward<decltype(choices)>(choices))
     {
     }
 
-    BitmapComboBox(wxWindowID identity, details::Ranges::input_range_of<std::tuple<wxString, wxBitmap>> auto&& choices)
+    BitmapComboBox(wxWindowID identity, details::Ranges::input_range_of<std::tuple<wxString, wxBitmapBundle>> auto&& choices)
         : details_(identity)
         , choices_(details::Ranges::ToVector<wxString>(choices | std::views::transform([](auto&& item) { return std::get<0>(item); })))
-        , bitmaps_(details::Ranges::ToVector<wxBitmap>(choices | std::views::transform([](auto&& item) { return std::get<1>(item); })))
+        , bitmaps_(std::make_shared<ItemBitmaps const>(ItemBitmaps { details::Ranges::ToVector<wxBitmapBundle>(choices | std::views::transform([](auto&& item) { return std::get<1>(item); })), {} }))
+    {
+    }
+
+    // The bitmap of each item comes from calling `bitmapOf` with its index,
+    // and only when it is needed: the selected item's when the control is
+    // made, and all the others in one go the first time the list drops down.
+    // Suits long lists, such as font pickers, that are often never opened.
+    // wx sizes every item from the first bitmap it is given, so if the
+    // selected item has none the items after it are asked for until one
+    // does, and the list has its height before it first drops down.
+    //
+    // The others are set from wxEVT_COMBOBOX_DROPDOWN, which wxMSW and
+    // wxGTK send for their native wxBitmapComboBox, and the generic one on
+    // the other ports, wxOSX among them, sends as a wxComboCtrl.  On a port
+    // that does not send it, only the bitmaps asked for when the control is
+    // made are shown.
+    //
+    // The index is that of the item in the control when the list drops
+    // down, so if the items are changed through the proxy's choices(),
+    // `bitmapOf` has to follow them.  Items that are new or different at
+    // their index since the last drop-down are asked for again then.
+    using BitmapProvider = std::function<wxBitmapBundle(size_t)>;
+
+    BitmapComboBox(details::Ranges::utf8_text_input_range auto&& choices, BitmapProvider bitmapOf)
+        : BitmapComboBox(wxID_ANY, std::forward<decltype(choices)>(choices), std::move(bitmapOf))
+    {
+    }
+
+    BitmapComboBox(wxWindowID identity, details::Ranges::utf8_text_input_range auto&& choices, BitmapProvider bitmapOf)
+        : details_(identity)
+        , choices_(details::toChoiceList(std::forward<decltype(choices)>(choices)))
+        , bitmaps_(std::make_shared<ItemBitmaps const>(ItemBitmaps { {}, std::move(bitmapOf) }))
     {
     }
 
@@ -105,6 +144,7 @@ struct BitmapComboBox {
         {
             auto* controller = control();
             return details::GetterSetter {
+                controller,
                 [controller] { return controller->GetValue().utf8_string(); },
                 [controller](std::string const& value) { controller->SetValue(wxString::FromUTF8(value)); }
             };
@@ -113,18 +153,36 @@ struct BitmapComboBox {
         {
             auto* controller = control();
             return details::GetterSetter {
+                controller,
                 [controller] { return controller->GetSelection(); },
                 [controller](int selection) { controller->SetSelection(selection); }
             };
         }
 
+        // The list of items; see ChoicesUpdate.
+        [[nodiscard]] auto choices(ChoicesUpdate how = ChoicesUpdate::Replace) const
+        {
+            auto* controller = control();
+            return details::GetterSetter {
+                controller,
+                [controller] { return details::getChoices(controller); },
+                [controller, how](std::vector<std::string> const& choices) { details::setChoices(controller, choices, how); }
+            };
+        }
+
         auto operator*() const { return value(); }
     };
 
 private:
     details::WidgetDetails<BitmapComboBox, wxBitmapComboBox> details_;
-    std::vector<wxString> choices_;
-    std::vector<wxBitmap> bitmaps_;
+    ChoiceList choices_;
+    // Either the bitmap of every item, or what to ask for them when they are
+    // needed.  Shared like choices_, so copying a description stays cheap.
+    struct ItemBitmaps {
+        std::vector<wxBitmapBundle> bitmaps;
+        BitmapProvider bitmapOf;
+    };
+    std::shared_ptr<ItemBitmaps const> bitmaps_;
     int selection_ = 0;
 
     template <typename Parent>
@@ -134,8 +192,34 @@ private:
             auto&& first = (choices.size() > 0) ? wxString(choices.at(0)) : wxString(wxEmptyString);
             auto* widget = customizations::ParentCreate<underlying_t>(parent, id, first, pos, size, static_cast<int>(choices.size()), choices.data(), style);
 
-            for (auto i = 0lu; i < bitmaps.size(); ++i) {
-                widget->SetItemBitmap(i, bitmaps[i]);
+            for (auto i = 0u; i < bitmaps->bitmaps.size(); ++i) {
+                widget->SetItemBitmap(i, bitmaps->bitmaps[i]);
+            }
+            if (bitmaps->bitmapOf && !choices.empty()) {
+                auto shown = (selection >= 0 && static_cast<size_t>(selection) < choices.size()) ? static_cast<unsigned>(selection) : 0u;
+                // The items that have their bitmap, by index.  The items may
+                // have been changed through the proxy since.
+                auto given = std::make_shared<std::vector<std::optional<wxString>>>(choices.size());
+                for (auto i = 0u; i < choices.size(); ++i) {
+                    auto index = static_cast<unsigned>((shown + i) % choices.size());
+                    auto bitmap = bitmaps->bitmapOf(index);
+                    widget->SetItemBitmap(index, bitmap);
+                    (*given)[index] = choices.at(index);
+                    if (bitmap.IsOk()) {
+                        break;
+                    }
+                }
+                customizations::ControllerBindDropDown(widget, [widget, bitmaps, given] {
+                    auto count = widget->GetCount();
+                    given->resize(count);
+                    for (auto i = 0u; i < count; ++i) {
+                        auto item = widget->GetString(i);
+                        if ((*given)[i] != item) {
+                            widget->SetItemBitmap(i, bitmaps->bitmapOf(i));
+                            (*given)[i] = std::move(item);
+                        }
+                    }
+                });
             }
             if (!choices.empty()) {
                 widget->SetSelection(selection);
@@ -23,6 +23,7 @@ SOFTWARE.
 */
 #pragma once
 
+#include <wx/bmpbndl.h>
 #include <wx/tglbtn.h>
 #include <wxUI/GetterSetter.hpp>
 #include <wxUI/Widget.hpp>
@@ -35,12 +36,12 @@ namespace wxUI {
 struct BitmapToggleButton {
     using underlying_t = wxBitmapToggleButton;
 
-    explicit BitmapToggleButton(wxBitmap const& bitmap, std::optional<wxBitmap> bitmapPressed = std::nullopt)
+    explicit BitmapToggleButton(wxBitmapBundle const& bitmap, std::optional<wxBitmapBundle> bitmapPressed = std::nullopt)
         : BitmapToggleButton(wxID_ANY, bitmap, std::move(bitmapPressed))
     {
     }
 
-    BitmapToggleButton(wxWindowID identity, wxBitmap const& bitmap, std::optional<wxBitmap> bitmapPressed = std::nullopt)
+    BitmapToggleButton(wxWindowID identity, wxBitmapBundle const& bitmap, std::optional<wxBitmapBundle> bitmapPressed = std::nullopt)
         : details_(identity)
         , bitmap_(bitmap)
         , bitmapPressed_(std::move(bitmapPressed))
@@ -66,6 +67,7 @@ struct BitmapToggleButton {
         {
             auto* controller = control();
             return details::GetterSetter {
+                controller,
                 [controller] { return controller->GetValue(); },
                 [controller](bool value) { controller->SetValue(value); }
             };
@@ -76,8 +78,8 @@ struct BitmapToggleButton {
 
 private:
     details::WidgetDetails<BitmapToggleButton, wxBitmapToggleButton> details_;
-    wxBitmap bitmap_;
-    std::optional<wxBitmap> bitmapPressed_;
+    wxBitmapBundle bitmap_;
+    std::optional<wxBitmapBundle> bitmapPressed_;
 
     template <typename Parent>
     auto createImpl()
@@ -34,6 +34,30 @@ SOFTWARE.
 #include <wxUI/Customizations.hpp>
 #include <wxUI/detail/BookDetails.hpp>
 
+namespace wxUI::customizations {
+
+template <>
+struct BookPageChangingEvent<wxNotebook> {
+    static auto type() { return wxEVT_NOTEBOOK_PAGE_CHANGING; }
+};
+
+template <>
+struct BookPageChangingEvent<wxChoicebook> {
+    static auto type() { return wxEVT_CHOICEBOOK_PAGE_CHANGING; }
+};
+
+template <>
+struct BookPageChangingEvent<wxListbook> {
+    static auto type() { return wxEVT_LISTBOOK_PAGE_CHANGING; }
+};
+
+template <>
+struct BookPageChangingEvent<wxTreebook> {
+    static auto type() { return wxEVT_TREEBOOK_PAGE_CHANGING; }
+};
+
+}
+
 namespace wxUI {
 
 template <details::SizerItem... Items>
@@ -24,6 +24,7 @@ SOFTWARE.
 #pragma once
 
 #include <wx/button.h>
+#include <wxUI/TextExtentCache.hpp>
 #include <wxUI/Widget.hpp>
 
 #include <wxUI/detail/HelperMacros.hpp>
@@ -93,11 +94,17 @@ private:
     auto createImpl()
     {
         return [&text = text_, isDefault = isDefault_](Parent* parent, wxWindowID id, wxPoint pos, wxSize size, int64_t style) {
-            auto* widget = customizations::ParentCreate<underlying_t>(parent, id, text, pos, size, style);
+            auto construct = [&](wxString const& label, wxSize labelSize) {
+                return customizations::ParentCreate<underlying_t>(parent, id, label, pos, labelSize, style);
+            };
+            // The default button is drawn bigger on some platforms, so it is
+            // left to measure itself.
             if (isDefault) {
+                auto* widget = construct(text, size);
                 widget->SetDefault();
+                return widget;
             }
-            return widget;
+            return TextExtentCache::instance().create<underlying_t>(parent, text, size, style, std::nullopt, construct, [](auto*) {});
         };
     }
 
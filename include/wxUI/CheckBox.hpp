@@ -99,6 +99,7 @@ struct CheckBox {
         {
             auto* controller = control();
             return details::GetterSetter {
+                controller,
                 [controller] { return controller->GetValue(); },
                 [controller](bool value) { controller->SetValue(value); }
             };
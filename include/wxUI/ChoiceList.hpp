@@ -0,0 +1,107 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+
+#include <wxUI/Widget.hpp>
+
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <wx/string.h>
+
+namespace wxUI {
+
+// ChoiceList is an immutable list of choices that descriptions share rather
+// than copy.  Build it once, and pass it to as many controllers as need it:
+//
+//     auto const units = wxUI::ChoiceList { allUnitNames() };
+//     wxUI::ComboBox { units }, wxUI::ComboBox { units }, ...
+//
+// Copying a ChoiceList, or a controller description holding one, only
+// copies a reference.
+class ChoiceList {
+public:
+    ChoiceList() = default;
+
+    explicit ChoiceList(std::vector<wxString> choices)
+        : choices_(std::make_shared<std::vector<wxString> const>(std::move(choices)))
+    {
+    }
+
+    template <typename String>
+    requires details::utf8_text_choice<String>
+    ChoiceList(std::initializer_list<String> choices)
+        : ChoiceList(details::Ranges::convertTo(choices))
+    {
+    }
+
+    template <details::Ranges::utf8_text_input_range Range>
+    requires(!std::same_as<std::remove_cvref_t<Range>, ChoiceList>)
+    explicit ChoiceList(Range&& choices)
+        : ChoiceList(details::Ranges::ToVectorUtf8(std::forward<Range>(choices)))
+    {
+    }
+
+    [[nodiscard]] auto size() const -> std::size_t { return choices_ ? choices_->size() : 0; }
+    [[nodiscard]] auto empty() const -> bool { return size() == 0; }
+    [[nodiscard]] auto data() const -> wxString const* { return choices_ ? choices_->data() : nullptr; }
+    [[nodiscard]] auto begin() const -> wxString const* { return data(); }
+    [[nodiscard]] auto end() const -> wxString const* { return data() + size(); }
+    [[nodiscard]] auto at(std::size_t index) const -> wxString const&
+    {
+        if (!choices_) {
+            throw std::out_of_range("ChoiceList::at");
+        }
+        return choices_->at(index);
+    }
+    [[nodiscard]] auto operator[](std::size_t index) const -> wxString const& { return (*choices_)[index]; }
+
+    // Whether the two lists share the same storage.
+    [[nodiscard]] auto shares(ChoiceList const& other) const -> bool { return choices_ == other.choices_; }
+
+private:
+    std::shared_ptr<std::vector<wxString> const> choices_ {};
+};
+
+}
+
+namespace wxUI::details {
+
+// Controllers take their choices from any range; a ChoiceList is shared
+// rather than converted again.
+template <Ranges::utf8_text_input_range Range>
+auto toChoiceList(Range&& choices) -> ChoiceList
+{
+    if constexpr (std::same_as<std::remove_cvref_t<Range>, ChoiceList>) {
+        return std::forward<Range>(choices);
+    } else {
+        return ChoiceList { Ranges::ToVectorUtf8(std::forward<Range>(choices)) };
+    }
+}
+
+}
@@ -24,8 +24,10 @@ SOFTWARE.
 #pragma once
 
 #include <wx/combobox.h>
+#include <wxUI/ChoiceList.hpp>
 #include <wxUI/GetterSetter.hpp>
 #include <wxUI/Widget.hpp>
+#include <wxUI/detail/ChoicesDetails.hpp>
 
 #include <wxUI/detail/HelperMacros.hpp>
 
@@ -82,7 +84,7 @@ struct ComboBox {
 
     ComboBox(wxWindowID identity, details::Ranges::utf8_text_input_range auto&& choices)
         : details_(identity)
-        , choices_(details::Ranges::ToVectorUtf8(std::forward<decltype(choices)>(choices)))
+        , choices_(details::toChoiceList(std::forward<decltype(choices)>(choices)))
     {
     }
 
@@ -125,6 +127,7 @@ struct ComboBox {
         {
             auto* controller = control();
             return details::GetterSetter {
+                controller,
                 [controller] { return controller->GetValue().utf8_string(); },
                 [controller](std::string const& value) { controller->SetValue(wxString::FromUTF8(value)); }
             };
@@ -133,17 +136,29 @@ struct ComboBox {
         {
             auto* controller = control();
             return details::GetterSetter {
+                controller,
                 [controller] { return controller->GetSelection(); },
                 [controller](int selection) { controller->SetSelection(selection); }
             };
         }
 
+        // The list of items; see ChoicesUpdate.
+        [[nodiscard]] auto choices(ChoicesUpdate how = ChoicesUpdate::Replace) const
+        {
+            auto* controller = control();
+            return details::GetterSetter {
+                controller,
+                [controller] { return details::getChoices(controller); },
+                [controller, how](std::vector<std::string> const& choices) { details::setChoices(controller, choices, how); }
+            };
+        }
+
         auto operator*() const { return value(); }
     };
 
 private:
     details::WidgetDetails<ComboBox, wxComboBox> details_;
-    std::vector<wxString> choices_;
+    ChoiceList choices_;
     int selection_ = 0;
 
     template <typename Parent>
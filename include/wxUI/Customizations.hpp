@@ -23,16 +23,24 @@ SOFTWARE.
 */
 #pragma once
 
+#include <algorithm>
+#include <chrono>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <tuple>
+#include <utility>
 #include <variant>
 #include <vector>
+#include <wx/app.h>
+#include <wx/bookctrl.h>
 #include <wx/frame.h>
 #include <wx/menu.h>
 #include <wx/sizer.h>
 #include <wx/statbox.h>
+#include <wx/timer.h>
 #include <wx/wrapsizer.h>
+#include <wx/wupdlock.h>
 
 namespace wxUI::customizations {
 
@@ -133,6 +141,143 @@ inline auto SizerCreate(Parent* parent, SizerInfo const& info) -> wxSizer*
     }
 }
 
+//--- Customization points for changing sizers in place ---//
+
+template <typename Sizer>
+inline auto SizerItemCount(Sizer* sizer) -> size_t
+{
+    if constexpr (std::is_convertible_v<Sizer*, wxSizer*>) {
+        return sizer->GetItemCount();
+    } else {
+        static_assert(always_false_v<Sizer>, "SizerItemCount: Provide a customization in namespace wxUI::customizations.");
+        return 0; // unreachable
+    }
+}
+
+// Removes the item at `index`, destroying any windows it holds.
+template <typename Sizer>
+inline void SizerRemoveItem(Sizer* sizer, size_t index)
+{
+    if constexpr (std::is_convertible_v<Sizer*, wxSizer*>) {
+        sizer->GetItem(index)->DeleteWindows();
+        sizer->Remove(static_cast<int>(index));
+    } else {
+        static_assert(always_false_v<Sizer>, "SizerRemoveItem: Provide a customization in namespace wxUI::customizations.");
+    }
+}
+
+// Moves the item at `from` so that it ends up at `to`, keeping its window.
+template <typename Sizer>
+inline void SizerMoveItem(Sizer* sizer, size_t from, size_t to)
+{
+    if constexpr (std::is_convertible_v<Sizer*, wxSizer*>) {
+        auto* item = sizer->GetItem(from);
+        sizer->GetChildren().DeleteObject(item);
+        // Insert sets the window's containing sizer, and asserts that it has
+        // none; Detach would delete the item, and with it the handle.
+        if (auto* window = item->GetWindow()) {
+            window->SetContainingSizer(nullptr);
+        }
+        sizer->Insert(to, item);
+    } else {
+        static_assert(always_false_v<Sizer>, "SizerMoveItem: Provide a customization in namespace wxUI::customizations.");
+    }
+}
+
+// Identifies the item at `index` for as long as it stays in the sizer,
+// wherever it is moved to.
+template <typename Sizer>
+inline auto SizerItemHandle(Sizer* sizer, size_t index) -> void const*
+{
+    if constexpr (std::is_convertible_v<Sizer*, wxSizer*>) {
+        return sizer->GetItem(index);
+    } else {
+        static_assert(always_false_v<Sizer>, "SizerItemHandle: Provide a customization in namespace wxUI::customizations.");
+        return nullptr; // unreachable
+    }
+}
+
+// Returns the current index of the item identified by `handle`, or the item
+// count if it is no longer in the sizer.
+template <typename Sizer>
+inline auto SizerItemIndex(Sizer* sizer, void const* handle) -> size_t
+{
+    if constexpr (std::is_convertible_v<Sizer*, wxSizer*>) {
+        auto index = size_t { 0 };
+        for (auto* item : sizer->GetChildren()) {
+            if (item == handle) {
+                break;
+            }
+            ++index;
+        }
+        return index;
+    } else {
+        static_assert(always_false_v<Sizer>, "SizerItemIndex: Provide a customization in namespace wxUI::customizations.");
+        return 0; // unreachable
+    }
+}
+
+// Applies a batch of changes to a sizer of `parent` with drawing suspended,
+// then lays out the window once.
+template <typename Parent, typename Sizer>
+inline void SizerUpdate(Parent* parent, [[maybe_unused]] Sizer* sizer, std::function<void()> const& changes)
+{
+    if constexpr (std::is_convertible_v<Parent*, wxWindow*>) {
+        auto noUpdates = wxWindowUpdateLocker { parent };
+        changes();
+        parent->Layout();
+    } else {
+        static_assert(always_false_v<Parent>, "SizerUpdate: Provide a customization in namespace wxUI::customizations.");
+    }
+}
+
+// Applies a batch of changes to `window` and its children with drawing
+// suspended, then lays out and repaints the window once.
+template <typename Window>
+inline void WindowUpdate(Window* window, std::function<void()> const& changes)
+{
+    if constexpr (std::is_convertible_v<Window*, wxWindow*>) {
+        {
+            auto noUpdates = wxWindowUpdateLocker { window };
+            changes();
+            window->Layout();
+        }
+        window->Refresh();
+    } else {
+        static_assert(always_false_v<Window>, "WindowUpdate: Provide a customization in namespace wxUI::customizations.");
+    }
+}
+
+// Returns the window `window` sits in, or nullptr for a top-level one.  Used
+// to find the Transaction that covers a control.
+template <typename Window>
+inline auto WindowParent(Window* window)
+{
+    if constexpr (std::is_convertible_v<Window*, wxWindow*>) {
+        return window->GetParent();
+    } else {
+        static_assert(always_false_v<Window>, "WindowParent: Provide a customization in namespace wxUI::customizations.");
+        return static_cast<Window*>(nullptr); // unreachable
+    }
+}
+
+// Calls `destroyed` when `window` itself is destroyed, for what has to let go
+// of it then.
+template <typename Window>
+inline void WindowBindDestroy(Window* window, std::function<void()> destroyed)
+{
+    if constexpr (std::is_convertible_v<Window*, wxWindow*>) {
+        window->Bind(wxEVT_DESTROY, [window, destroyed = std::move(destroyed)](wxWindowDestroyEvent& event) {
+            if (event.GetEventObject() == window) {
+                destroyed();
+            }
+            event.Skip();
+        });
+    } else {
+        static_assert(always_false_v<Window>, "WindowBindDestroy: Provide a customization in namespace wxUI::customizations.");
+    }
+}
+
 //--- Customization points for controllers ---//
 
 template <typename Controller, typename BoundFunction>
@@ -145,16 +290,259 @@ inline void ControllerBindEvent(Controller* controller, BoundFunction const& bou
     }
 }
 
+// Adds the handler to the dispatcher of the container the controller is laid
+// out in; handlers for events that do not propagate to the container are
+// bound to the controller.
+template <typename Controller, typename Dispatcher, typename BoundFunction>
+inline void ControllerDispatchEvent(Controller* controller, Dispatcher& dispatcher, BoundFunction const& boundedFunction)
+{
+    if constexpr (std::is_convertible_v<Controller*, wxWindow*>) {
+        if (!boundedFunction.addTo(dispatcher, controller->GetId(), static_cast<wxObject const*>(controller))) {
+            boundedFunction.bindTo(controller);
+        }
+    } else {
+        static_assert(always_false_v<Controller>, "ControllerDispatchEvent: Provide a customization in namespace wxUI::customizations.");
+    }
+}
+
+// Binds one handler per event type in the dispatcher to the container.
+// Events the dispatcher has no handler for carry on up to the parents.
+// wxWindowDestroyEvent is a command event too, so the container also hears
+// of each control that goes and removes its handlers.
+template <typename Parent, typename Dispatcher>
+inline void ContainerBindDispatcher(Parent* parent, std::shared_ptr<Dispatcher> dispatcher)
+{
+    if constexpr (std::is_convertible_v<Parent*, wxWindow*>) {
+        for (auto type : dispatcher->eventTypes()) {
+            parent->Bind(wxEventTypeTag<wxCommandEvent>(type), [dispatcher, type](wxCommandEvent& event) {
+                if (!dispatcher->dispatch(type, event.GetId(), static_cast<wxObject const*>(event.GetEventObject()), event)) {
+                    event.Skip();
+                }
+            });
+        }
+        parent->Bind(wxEVT_DESTROY, [dispatcher](wxWindowDestroyEvent& event) {
+            dispatcher->remove(static_cast<wxObject const*>(event.GetEventObject()));
+            event.Skip();
+        });
+    } else {
+        static_assert(always_false_v<Parent>, "ContainerBindDispatcher: Provide a customization in namespace wxUI::customizations.");
+    }
+}
+
 template <typename Controller, typename Proxy>
 inline void ControllerBindProxy(Controller* controller, Proxy& proxyHandle)
 {
     if constexpr (requires(Proxy proxy, Controller* c) { proxy.setUnderlying(c); }) {
         proxyHandle.setUnderlying(controller);
+        if constexpr (std::is_convertible_v<Controller*, wxWindow*>) {
+            // Detach every copy when the control goes, so that writes still
+            // posted to it are dropped rather than applied to freed memory.
+            // The proxy may have moved on to a newer control by then, which
+            // stays attached.
+            controller->Bind(wxEVT_DESTROY, [proxyHandle, controller](wxWindowDestroyEvent& event) mutable {
+                auto attached = [&] {
+                    if constexpr (requires { proxyHandle.control(); }) {
+                        return proxyHandle.control();
+                    } else {
+                        return proxyHandle.window();
+                    }
+                };
+                if (event.GetEventObject() == controller && attached() == controller) {
+                    proxyHandle.setUnderlying(nullptr);
+                }
+                event.Skip();
+            });
+        }
     } else {
         static_assert(always_false_v<Proxy>, "ControllerBindProxy: Provide a customization in namespace wxUI::customizations.");
     }
 }
 
+// The size `controller` needs, which Prototype measures on the first copy it
+// stamps out.  Parents that are not windows have no best size to reuse.
+template <typename Controller>
+inline auto ControllerBestSize([[maybe_unused]] Controller* controller) -> wxSize
+{
+    if constexpr (std::is_convertible_v<Controller*, wxWindow*>) {
+        return controller->GetBestSize();
+    } else {
+        return wxDefaultSize;
+    }
+}
+
+// Gives the later copies a Prototype stamps out the best size of the first,
+// so that their sizers do not measure them again.
+template <typename Controller>
+inline void ControllerSetMinSize([[maybe_unused]] Controller* controller, [[maybe_unused]] wxSize size)
+{
+    if constexpr (std::is_convertible_v<Controller*, wxWindow*>) {
+        controller->SetMinSize(size);
+    }
+}
+
+// What the labels of controllers made in a parent are measured with: the
+// font the controllers get from the parent, and the parent's DPI scale.
+struct TextExtentContext {
+    wxFont font {};
+    wxString fontDescription {};
+    double scale {};
+};
+
+// A label as wxWidgets measured it: the label once wrapped, and the best size
+// of the controller showing it.
+struct TextExtent {
+    wxString label {};
+    wxSize bestSize {};
+};
+
+// Controllers take the font of the window they are made in, so labels made in
+// `parent` are measured with its font.  Parents that are not windows do not
+// measure labels.
+template <typename Parent>
+inline auto ParentTextExtentContext([[maybe_unused]] Parent* parent) -> std::optional<TextExtentContext>
+{
+    if constexpr (std::is_convertible_v<Parent*, wxWindow*>) {
+        auto font = parent->GetFont();
+        auto description = font.GetNativeFontInfoDesc();
+        return TextExtentContext { std::move(font), std::move(description), parent->GetDPIScaleFactor() };
+    } else {
+        return std::nullopt;
+    }
+}
+
+// The label and best size `controller` was given, provided it was made with
+// the font of `context`.
+template <typename Controller>
+inline auto ControllerTextExtent([[maybe_unused]] Controller* controller, [[maybe_unused]] TextExtentContext const& context) -> std::optional<TextExtent>
+{
+    if constexpr (std::is_convertible_v<Controller*, wxWindow*>) {
+        if (controller->GetFont() == context.font) {
+            return TextExtent { controller->GetLabel(), controller->GetBestSize() };
+        }
+    }
+    return std::nullopt;
+}
+
+// `controller` was made from the label and best size of `extent`; have it
+// keep that best size rather than measure itself.  If it did not get the font
+// of `context` after all, it is given back `label` to measure, and this
+// returns false.
+template <typename Controller>
+inline auto ControllerUseTextExtent([[maybe_unused]] Controller* controller, [[maybe_unused]] TextExtentContext const& context, [[maybe_unused]] TextExtent const& extent, [[maybe_unused]] wxString const& label) -> bool
+{
+    if constexpr (std::is_convertible_v<Controller*, wxWindow*>) {
+        controller->SetMinSize(wxDefaultSize);
+        if (controller->GetFont() == context.font) {
+            controller->CacheBestSize(extent.bestSize);
+            return true;
+        }
+        controller->SetLabel(label);
+        controller->InvalidateBestSize();
+        controller->SetSize(controller->GetBestSize());
+    }
+    return false;
+}
+
+// Arranges for `drain` to be called on the UI thread.  This is called from
+// worker threads when they post writes through a proxy of `Controller`; the
+// pointer only selects the overload and is not dereferenced.
+template <typename Controller>
+inline void ProxyPostWake([[maybe_unused]] Controller* controller, std::function<void()> drain)
+{
+    if (auto* app = wxTheApp) {
+        app->CallAfter(std::move(drain));
+    }
+}
+
+// Calls `tick` on the UI thread every `interval` until it returns false.
+// Drives details::Sampler; `controller` is the control whose reporter or
+// log started the timer.  The timer belongs to the top-level window of
+// `controller`.  If that window is destroyed first the timer goes with it,
+// and `stopped` is called once the window is gone so that the sampler can
+// start a new timer for controls in other windows.
+template <typename Controller>
+inline void SamplerTimerStart([[maybe_unused]] Controller* controller, std::chrono::milliseconds interval, std::function<bool()> tick, std::function<void()> stopped)
+{
+    if constexpr (std::is_convertible_v<Controller*, wxWindow*>) {
+        wxWindow* owner = wxGetTopLevelParent(controller);
+        if (owner == nullptr) {
+            owner = controller;
+        }
+        // `timer` is cleared once the timer is stopped, by whichever side
+        // gets there first.  `onDestroy` is kept here so that it can be
+        // unbound again.
+        struct Running {
+            wxWindow* owner;
+            wxTimer* timer;
+            std::function<void(wxWindowDestroyEvent&)> onDestroy;
+        };
+        auto running = std::make_shared<Running>(Running { owner, new wxTimer {}, {} });
+        running->onDestroy = [weak = std::weak_ptr { running }, stopped = std::move(stopped)](wxWindowDestroyEvent& event) {
+            auto running = weak.lock();
+            if (running && event.GetEventObject() == running->owner && running->timer != nullptr) {
+                auto* timer = std::exchange(running->timer, nullptr);
+                timer->Stop();
+                delete timer;
+                if (auto* app = wxTheApp) {
+                    app->CallAfter(stopped);
+                }
+            }
+            event.Skip();
+        };
+        running->timer->Bind(wxEVT_TIMER, [running, tick = std::move(tick)](wxTimerEvent&) {
+            if (running->timer != nullptr && !tick()) {
+                auto* timer = std::exchange(running->timer, nullptr);
+                timer->Stop();
+                running->owner->Unbind(wxEVT_DESTROY, running->onDestroy);
+                if (auto* app = wxTheApp) {
+                    app->CallAfter([timer] { delete timer; });
+                }
+            }
+        });
+        owner->Bind(wxEVT_DESTROY, running->onDestroy);
+        running->timer->Start(static_cast<int>(interval.count()));
+    } else {
+        static_assert(always_false_v<Controller>, "SamplerTimerStart: Provide a customization in namespace wxUI::customizations.");
+    }
+}
+
+// Removes the first `removeLines` lines of a TextCtrl used as a TextLog and
+// appends `text`.  If the control has no more lines than that, it is
+// emptied, including a last line without a newline.  The view only follows
+// the new text if it was scrolled to the end already; the caret stays where
+// the user left it.
+template <typename Controller>
+inline void TextLogUpdate(Controller* controller, long removeLines, wxString const& text)
+{
+    if constexpr (std::is_convertible_v<Controller*, wxWindow*>) {
+        auto atEnd = controller->GetScrollPos(wxVERTICAL) + controller->GetScrollThumb(wxVERTICAL) >= controller->GetScrollRange(wxVERTICAL);
+        auto caret = controller->GetInsertionPoint();
+        auto caretAtEnd = caret == controller->GetLastPosition();
+        auto noUpdates = wxWindowUpdateLocker { controller };
+        // Positions come from the control, which on some platforms counts a
+        // newline as two.
+        auto removed = 0L;
+        if (removeLines > 0) {
+            removed = controller->XYToPosition(0, removeLines);
+            if (removed < 0) {
+                removed = controller->GetLastPosition();
+            }
+            controller->Remove(0, removed);
+        }
+        controller->AppendText(text);
+        if (caretAtEnd) {
+            controller->SetInsertionPointEnd();
+        } else {
+            controller->SetInsertionPoint(std::max(caret - removed, 0L));
+        }
+        if (atEnd) {
+            controller->ShowPosition(controller->GetLastPosition());
+        }
+    } else {
+        static_assert(always_false_v<Controller>, "TextLogUpdate: Provide a customization in namespace wxUI::customizations.");
+    }
+}
+
 template <typename Sizer, typename Proxy>
 inline void SizerBindProxy(Sizer* sizer, Proxy& proxyHandle)
 {
@@ -165,6 +553,67 @@ inline void SizerBindProxy(Sizer* sizer, Proxy& proxyHandle)
     }
 }
 
+// Book customization points
+
+// Event a book control sends just before switching pages.  Book types that
+// send their own flavour of page-changing event specialize this (see
+// BookCtrl.hpp).
+template <typename Book>
+struct BookPageChangingEvent {
+    static auto type() { return wxEVT_BOOKCTRL_PAGE_CHANGING; }
+};
+
+// Defers populating a book page until it is first shown.  `realize` is run
+// at most once: straight away if the page is already the current one,
+// otherwise the first time the book is about to switch to it.
+template <typename Book, typename Page>
+inline void BookBindLazyPage(Book* book, Page* page, std::function<void()> realize)
+{
+    if constexpr (std::is_convertible_v<Book*, wxBookCtrlBase*>) {
+        auto pending = std::make_shared<std::function<void()>>(std::move(realize));
+        auto realizeOnce = [page, pending] {
+            if (!*pending) {
+                return;
+            }
+            auto populate = std::exchange(*pending, nullptr);
+            // Populating fits the page to its contents; the book has already
+            // sized the page, so restore that and lay out within it.
+            auto size = page->GetSize();
+            populate();
+            page->SetSize(size);
+            page->Layout();
+        };
+        book->Bind(BookPageChangingEvent<Book>::type(), [book, page, realizeOnce](wxBookCtrlEvent& event) {
+            event.Skip();
+            auto selection = event.GetSelection();
+            // Page-changing events propagate, ignore those from nested books.
+            if (event.GetEventObject() == book && selection != wxNOT_FOUND && book->GetPage(static_cast<size_t>(selection)) == page) {
+                realizeOnce();
+            }
+        });
+        if (book->GetCurrentPage() == page) {
+            realizeOnce();
+        }
+    } else {
+        static_assert(always_false_v<Book>, "BookBindLazyPage: Provide a customization in namespace wxUI::customizations.");
+    }
+}
+
+// Calls `populate` each time the list of `controller` is about to drop
+// down.
+template <typename Controller>
+inline void ControllerBindDropDown(Controller* controller, std::function<void()> populate)
+{
+    if constexpr (std::is_convertible_v<Controller*, wxWindow*>) {
+        controller->Bind(wxEVT_COMBOBOX_DROPDOWN, [populate = std::move(populate)](wxCommandEvent& event) {
+            event.Skip();
+            populate();
+        });
+    } else {
+        static_assert(always_false_v<Controller>, "ControllerBindDropDown: Provide a customization in namespace wxUI::customizations.");
+    }
+}
+
 // Menu creation customization points
 // These allow tests to avoid creating real wxMenu/wxMenuBar objects
 
@@ -257,4 +706,21 @@ void MenuBindToFrame(Frame& frame, int identity, std::variant<std::function<void
     }
 }
 
+// Binds the one wxEVT_MENU handler of a MenuBar using a dispatcher.  Ids the
+// dispatcher has no handler for are skipped on to the frame's other handlers.
+template <typename Frame, typename Dispatcher>
+void MenuBindDispatcher(Frame& frame, std::shared_ptr<Dispatcher const> dispatcher)
+{
+    using ::wxUI::customizations::always_false_v;
+    if constexpr (std::is_convertible_v<Frame*, wxFrame*>) {
+        frame.Bind(wxEVT_MENU, [dispatcher = std::move(dispatcher)](wxCommandEvent& event) {
+            if (!dispatcher->dispatch(event.GetId(), event)) {
+                event.Skip();
+            }
+        });
+    } else {
+        static_assert(always_false_v<Frame>, "Provide MenuBindDispatcher customization for this Frame type");
+    }
+}
+
 }
@@ -0,0 +1,341 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <wxUI/Layout.hpp>
+#include <wxUI/detail/HelperMacros.hpp>
+#include <wxUI/detail/SmallStorage.hpp>
+
+namespace wxUI::details {
+
+// One sizer item with its type erased, for a given Parent and Sizer.  Items
+// that fit in kInlineSize, which covers the usual controllers, are stored
+// inline so a vector of them does not allocate per element; larger ones, such
+// as nested sizers, are kept on the heap.
+template <typename Parent, typename Sizer>
+class DynamicItem {
+public:
+    static constexpr auto kInlineSize = 16 * sizeof(void*);
+
+    template <typename Item>
+        requires(SizerItem<std::remove_cvref_t<Item>> && !std::same_as<std::remove_cvref_t<Item>, DynamicItem>)
+    explicit DynamicItem(Item&& item)
+        : item_(std::in_place_type<DynamicItemDetails<std::remove_cvref_t<Item>>>, std::forward<Item>(item))
+    {
+    }
+
+    void createAndAdd(Parent* parent, Sizer* sizer, wxSizerFlags const& flags)
+    {
+        item_->createAndAdd(parent, sizer, flags);
+    }
+
+    // Whether an Item is stored without a heap allocation of its own.
+    template <typename Item>
+    static constexpr auto storedInline() -> bool
+    {
+        return Storage::template fitsInline<DynamicItemDetails<Item>>();
+    }
+
+private:
+    struct DynamicItemDetailsBase : Storable<DynamicItemDetailsBase> {
+        virtual void createAndAdd(Parent* parent, Sizer* sizer, wxSizerFlags const& flags) = 0;
+    };
+
+    template <typename Item>
+    struct DynamicItemDetails : DynamicItemDetailsBase {
+        explicit DynamicItemDetails(Item const& item)
+            : item(item)
+        {
+        }
+        explicit DynamicItemDetails(Item&& item)
+            : item(std::move(item))
+        {
+        }
+        Item item;
+        void createAndAdd(Parent* parent, Sizer* sizer, wxSizerFlags const& flags) override
+        {
+            details::createAndAddVisiter(item, parent, sizer, flags);
+        }
+    };
+
+    using Storage = SmallStorage<DynamicItemDetailsBase, kInlineSize>;
+    Storage item_;
+};
+
+template <typename Parent, typename Sizer>
+struct DynamicItems {
+    std::vector<DynamicItem<Parent, Sizer>> items;
+
+    void createAndAdd(Parent* parent, Sizer* sizer, wxSizerFlags const& flags)
+    {
+        for (auto& item : items) {
+            item.createAndAdd(parent, sizer, flags);
+        }
+    }
+};
+
+// The BoxSizer behind DynamicVSizer and DynamicHSizer.  It shares SizerBase
+// with Sizer<Items...>, so flags, proxies and dispatchers work the same way.
+template <typename Parent, typename Sizer>
+struct DynamicBoxSizer : private SizerBase {
+    explicit DynamicBoxSizer(wxOrientation orientation)
+        : creator_ { orientation, false, std::nullopt }
+    {
+    }
+
+    DynamicBoxSizer(wxOrientation orientation, wxSizerFlags const& flags)
+        : SizerBase(flags)
+        , creator_ { orientation, false, std::nullopt }
+    {
+    }
+
+    DynamicBoxSizer(wxOrientation orientation, wxString caption)
+        : creator_ { orientation, false, std::move(caption) }
+    {
+    }
+
+    DynamicBoxSizer(wxOrientation orientation, wxString caption, wxSizerFlags const& flags)
+        : SizerBase(flags)
+        , creator_ { orientation, false, std::move(caption) }
+    {
+    }
+
+    template <SizerItem Item>
+    void add(Item&& item)
+    {
+        items_.items.emplace_back(std::forward<Item>(item));
+    }
+
+    void reserve(std::size_t count)
+    {
+        items_.items.reserve(count);
+    }
+
+    [[nodiscard]] auto size() const -> std::size_t
+    {
+        return items_.items.size();
+    }
+
+    void withFlags(wxSizerFlags flags)
+    {
+        flags_ = flags;
+    }
+
+    void withProxy(SizerProxy const& proxy)
+    {
+        proxyHandles_.push_back(proxy);
+    }
+
+    void withDispatcher()
+    {
+        dispatcher_ = true;
+    }
+
+    template <typename UParent, typename USizer>
+    auto createAndAdd(UParent* parent, USizer* parentSizer, wxSizerFlags const& parentFlags) -> Sizer*
+    {
+        Parent* typedParent = parent;
+        return createAndAddItems(creator_, items_, typedParent, parentSizer, parentFlags);
+    }
+
+    template <typename UParent>
+    auto fitTo(UParent* parent) -> UParent*
+    {
+        Parent* typedParent = parent;
+        fitItemsTo(creator_, items_, typedParent);
+        return parent;
+    }
+
+private:
+    BoxSizerCreator creator_;
+    DynamicItems<Parent, Sizer> items_;
+};
+
+}
+
+namespace wxUI {
+
+// DynamicVSizer and DynamicHSizer lay out items that are only known at run
+// time, such as a form built from configuration.  Items are added one at a
+// time and stored type-erased, so the sizer is the same type whatever it
+// holds.  Parent and Sizer are the types it will be created with.
+template <typename Parent = wxWindow, typename Sizer = wxSizer>
+struct DynamicVSizer {
+    DynamicVSizer()
+        : details_(wxVERTICAL)
+    {
+    }
+
+    explicit DynamicVSizer(std::string_view caption)
+        : details_(wxVERTICAL, details::toWxString(caption))
+    {
+    }
+
+    DynamicVSizer(wxUI_String, wxString caption)
+        : details_(wxVERTICAL, std::move(caption))
+    {
+    }
+
+    explicit DynamicVSizer(wxSizerFlags const& flags)
+        : details_(wxVERTICAL, flags)
+    {
+    }
+
+    DynamicVSizer(std::string_view caption, wxSizerFlags const& flags)
+        : details_(wxVERTICAL, details::toWxString(caption), flags)
+    {
+    }
+
+    DynamicVSizer(wxUI_String, wxString caption, wxSizerFlags const& flags)
+        : details_(wxVERTICAL, std::move(caption), flags)
+    {
+    }
+
+    template <details::SizerItem Item>
+    auto add(Item&& item) & -> DynamicVSizer&
+    {
+        details_.add(std::forward<Item>(item));
+        return *this;
+    }
+
+    template <details::SizerItem Item>
+    auto add(Item&& item) && -> DynamicVSizer&&
+    {
+        details_.add(std::forward<Item>(item));
+        return std::move(*this);
+    }
+
+    void reserve(std::size_t count)
+    {
+        details_.reserve(count);
+    }
+
+    [[nodiscard]] auto size() const -> std::size_t
+    {
+        return details_.size();
+    }
+
+    template <typename UParent, typename USizer>
+    auto createAndAdd(UParent* parent, USizer* parentSizer, wxSizerFlags const& parentFlags) -> Sizer*
+    {
+        return details_.createAndAdd(parent, parentSizer, parentFlags);
+    }
+
+    template <typename UParent>
+    auto fitTo(UParent* parent) -> UParent*
+    {
+        return details_.fitTo(parent);
+    }
+
+    WXUI_FORWARD_TO_DETAILS(DynamicVSizer, withFlags, wxSizerFlags, flags)
+    WXUI_FORWARD_TO_DETAILS(DynamicVSizer, withProxy, SizerProxy, proxy)
+    WXUI_FORWARD_NOARG_TO_DETAILS(DynamicVSizer, withDispatcher)
+
+private:
+    details::DynamicBoxSizer<Parent, Sizer> details_;
+};
+
+template <typename Parent = wxWindow, typename Sizer = wxSizer>
+struct DynamicHSizer {
+    DynamicHSizer()
+        : details_(wxHORIZONTAL)
+    {
+    }
+
+    explicit DynamicHSizer(std::string_view caption)
+        : details_(wxHORIZONTAL, details::toWxString(caption))
+    {
+    }
+
+    DynamicHSizer(wxUI_String, wxString caption)
+        : details_(wxHORIZONTAL, std::move(caption))
+    {
+    }
+
+    explicit DynamicHSizer(wxSizerFlags const& flags)
+        : details_(wxHORIZONTAL, flags)
+    {
+    }
+
+    DynamicHSizer(std::string_view caption, wxSizerFlags const& flags)
+        : details_(wxHORIZONTAL, details::toWxString(caption), flags)
+    {
+    }
+
+    DynamicHSizer(wxUI_String, wxString caption, wxSizerFlags const& flags)
+        : details_(wxHORIZONTAL, std::move(caption), flags)
+    {
+    }
+
+    template <details::SizerItem Item>
+    auto add(Item&& item) & -> DynamicHSizer&
+    {
+        details_.add(std::forward<Item>(item));
+        return *this;
+    }
+
+    template <details::SizerItem Item>
+    auto add(Item&& item) && -> DynamicHSizer&&
+    {
+        details_.add(std::forward<Item>(item));
+        return std::move(*this);
+    }
+
+    void reserve(std::size_t count)
+    {
+        details_.reserve(count);
+    }
+
+    [[nodiscard]] auto size() const -> std::size_t
+    {
+        return details_.size();
+    }
+
+    template <typename UParent, typename USizer>
+    auto createAndAdd(UParent* parent, USizer* parentSizer, wxSizerFlags const& parentFlags) -> Sizer*
+    {
+        return details_.createAndAdd(parent, parentSizer, parentFlags);
+    }
+
+    template <typename UParent>
+    auto fitTo(UParent* parent) -> UParent*
+    {
+        return details_.fitTo(parent);
+    }
+
+    WXUI_FORWARD_TO_DETAILS(DynamicHSizer, withFlags, wxSizerFlags, flags)
+    WXUI_FORWARD_TO_DETAILS(DynamicHSizer, withProxy, SizerProxy, proxy)
+    WXUI_FORWARD_NOARG_TO_DETAILS(DynamicHSizer, withDispatcher)
+
+private:
+    details::DynamicBoxSizer<Parent, Sizer> details_;
+};
+
+}
+
+#include <wxUI/detail/ZapMacros.hpp>
@@ -23,6 +23,13 @@ SOFTWARE.
 */
 #pragma once
 
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include <wxUI/Layout.hpp>
 #include <wxUI/wxUITypes.hpp>
 
@@ -82,6 +89,402 @@ ForEach(std::initializer_list<T>, Function&&) -> ForEach<std::vector<T>, Functio
 template <typename Function, typename T>
 ForEach(wxSizerFlags const& flags, std::initializer_list<T>, Function&&) -> ForEach<std::vector<T>, Function>;
 
+// Handle for updating the items of a KeyedForEach after it has been created.
+template <typename Value>
+struct KeyedForEachProxy {
+    // Reconcile the KeyedForEach with `values`: items for new keys are
+    // created, items for missing keys are destroyed, and the rest are
+    // reordered in place.  Items whose key is kept are not recreated.
+    template <std::ranges::input_range Range>
+    requires std::convertible_to<std::ranges::range_reference_t<Range>, Value>
+    void update(Range&& values) const
+    {
+        if (!*reconcile_) {
+            throw std::runtime_error("Proxy class has not been attached");
+        }
+        if constexpr (std::same_as<std::remove_cvref_t<Range>, std::vector<Value>>) {
+            (*reconcile_)(values);
+        } else {
+            auto copy = std::vector<Value> {};
+            for (auto&& value : values) {
+                copy.push_back(std::forward<decltype(value)>(value));
+            }
+            (*reconcile_)(copy);
+        }
+    }
+
+    void setReconciler(std::function<void(std::vector<Value> const&)> reconcile)
+    {
+        *reconcile_ = std::move(reconcile);
+    }
+
+private:
+    std::shared_ptr<std::function<void(std::vector<Value> const&)>> reconcile_ = std::make_shared<std::function<void(std::vector<Value> const&)>>();
+};
+
+namespace details {
+
+    template <typename Function, typename Value>
+    auto invokeForEach(Function& function, Value const& value) -> decltype(auto)
+    {
+        if constexpr (CanApply<Function, std::remove_cvref_t<Value>>::value) {
+            return std::apply(function, value);
+        } else {
+            return function(value);
+        }
+    }
+
+    // Marks the entries of `sequence` that make up one of its longest
+    // strictly increasing subsequences.  `npos` entries are never marked.
+    inline auto longestIncreasingSubsequence(std::vector<size_t> const& sequence) -> std::vector<bool>
+    {
+        constexpr auto npos = static_cast<size_t>(-1);
+        auto tails = std::vector<size_t> {}; // index into sequence of the tail of each run length
+        auto previous = std::vector<size_t>(sequence.size(), npos);
+        for (auto i = size_t { 0 }; i < sequence.size(); ++i) {
+            if (sequence[i] == npos) {
+                continue;
+            }
+            auto at = std::ranges::lower_bound(tails, sequence[i], {}, [&sequence](size_t index) { return sequence[index]; });
+            if (at != tails.begin()) {
+                previous[i] = *(at - 1);
+            }
+            if (at == tails.end()) {
+                tails.push_back(i);
+            } else {
+                *at = i;
+            }
+        }
+        auto result = std::vector<bool>(sequence.size(), false);
+        for (auto i = tails.empty() ? npos : tails.back(); i != npos; i = previous[i]) {
+            result[i] = true;
+        }
+        return result;
+    }
+
+    // Running sums over a fixed number of slots (a Fenwick tree), so that
+    // a slot can change and a prefix be summed in logarithmic time.
+    class PrefixSums {
+    public:
+        explicit PrefixSums(size_t size)
+            : tree_(size + 1)
+        {
+        }
+
+        void add(size_t slot, size_t amount)
+        {
+            for (auto i = slot + 1; i < tree_.size(); i += i & (~i + 1)) {
+                tree_[i] += amount;
+            }
+        }
+
+        void remove(size_t slot, size_t amount)
+        {
+            for (auto i = slot + 1; i < tree_.size(); i += i & (~i + 1)) {
+                tree_[i] -= amount;
+            }
+        }
+
+        // Sum of the slots before `slot`.
+        [[nodiscard]] auto prefix(size_t slot) const -> size_t
+        {
+            auto sum = size_t { 0 };
+            for (auto i = slot; i > 0; i -= i & (~i + 1)) {
+                sum += tree_[i];
+            }
+            return sum;
+        }
+
+    private:
+        std::vector<size_t> tree_;
+    };
+
+    // Tracks which sizer items belong to which key so a KeyedForEach can be
+    // brought up to date without rebuilding it.  The items are expected to be
+    // a contiguous block of the sizer; other items may come and go around
+    // it, so the block is found again on each update.
+    template <typename Value, typename Parent, typename Sizer, typename KeyFunction, typename Function>
+    class KeyedForEachReconciler {
+    public:
+        using Key = std::remove_cvref_t<decltype(invokeForEach(std::declval<KeyFunction&>(), std::declval<Value const&>()))>;
+
+        KeyedForEachReconciler(Parent* parent, Sizer* sizer, wxSizerFlags const& flags, KeyFunction keyFunction, Function createFunction)
+            : parent_(parent)
+            , sizer_(sizer)
+            , flags_(flags)
+            , keyFunction_(std::move(keyFunction))
+            , createFunction_(std::move(createFunction))
+            , offset_(customizations::SizerItemCount(sizer))
+        {
+        }
+
+        template <typename Range>
+        void createAll(Range& values)
+        {
+            auto seen = std::unordered_set<Key> {};
+            for (auto&& value : values) {
+                auto key = keyOf(value);
+                if (!seen.insert(key).second) {
+                    throw std::runtime_error("KeyedForEach: duplicate key");
+                }
+                auto count = create(value);
+                entries_.push_back({ std::move(key), count });
+            }
+            track(offset_);
+        }
+
+        void update(std::vector<Value> const& values)
+        {
+            constexpr auto npos = static_cast<size_t>(-1);
+            auto keys = std::vector<Key> {};
+            keys.reserve(values.size());
+            auto newIndex = std::unordered_map<Key, size_t> {};
+            for (auto const& value : values) {
+                keys.push_back(keyOf(value));
+                if (!newIndex.emplace(keys.back(), keys.size() - 1).second) {
+                    throw std::runtime_error("KeyedForEach: duplicate key");
+                }
+            }
+
+            customizations::SizerUpdate(parent_, sizer_, [&] {
+                auto start = blockStart();
+                removeMissing(start, newIndex);
+
+                // Entries that are already in increasing order stay put;
+                // everything else is moved next to its successor.
+                auto oldIndex = std::unordered_map<Key, size_t> {};
+                for (auto i = size_t { 0 }; i < entries_.size(); ++i) {
+                    oldIndex.emplace(entries_[i].key, i);
+                }
+                auto sources = std::vector<size_t>(keys.size(), npos);
+                for (auto i = size_t { 0 }; i < keys.size(); ++i) {
+                    if (auto found = oldIndex.find(keys[i]); found != oldIndex.end()) {
+                        sources[i] = found->second;
+                    }
+                }
+                auto stable = longestIncreasingSubsequence(sources);
+
+                // Items are counted in the slot of the entry they sit in
+                // front of: an entry that has not moved yet in its own slot,
+                // a moved one in the slot of the stable entry (or the end of
+                // the block) it now precedes.  The offset of either kind is
+                // then a prefix sum.
+                auto items = PrefixSums { entries_.size() + 1 };
+                for (auto i = size_t { 0 }; i < entries_.size(); ++i) {
+                    items.add(i, entries_[i].count);
+                }
+                auto counts = std::vector<size_t>(keys.size());
+                auto successor = entries_.size();
+                for (auto i = keys.size(); i-- > 0;) {
+                    if (stable[i]) {
+                        successor = sources[i];
+                        counts[i] = entries_[successor].count;
+                        continue;
+                    }
+                    auto before = start + items.prefix(successor);
+                    if (sources[i] == npos) {
+                        auto from = customizations::SizerItemCount(sizer_);
+                        counts[i] = create(values[i]);
+                        moveItems(from, counts[i], before);
+                    } else {
+                        counts[i] = entries_[sources[i]].count;
+                        moveItems(start + items.prefix(sources[i]), counts[i], before);
+                        items.remove(sources[i], counts[i]);
+                    }
+                    items.add(successor, counts[i]);
+                }
+
+                auto updated = std::vector<Entry> {};
+                updated.reserve(keys.size());
+                for (auto i = size_t { 0 }; i < keys.size(); ++i) {
+                    updated.push_back({ std::move(keys[i]), counts[i] });
+                }
+                entries_ = std::move(updated);
+                track(start);
+            });
+        }
+
+    private:
+        struct Entry {
+            Key key;
+            size_t count {};
+        };
+
+        auto keyOf(Value const& value) -> Key
+        {
+            return invokeForEach(keyFunction_, value);
+        }
+
+        // Creates the item(s) for `value` at the end of the sizer.
+        auto create(Value const& value) -> size_t
+        {
+            auto before = customizations::SizerItemCount(sizer_);
+            invokeForEach(createFunction_, value).createAndAdd(parent_, sizer_, flags_);
+            return customizations::SizerItemCount(sizer_) - before;
+        }
+
+        void removeMissing(size_t start, std::unordered_map<Key, size_t> const& keep)
+        {
+            auto end = start + itemCount();
+            for (auto i = entries_.size(); i-- > 0;) {
+                end -= entries_[i].count;
+                if (keep.contains(entries_[i].key)) {
+                    continue;
+                }
+                for (auto n = size_t { 0 }; n < entries_[i].count; ++n) {
+                    customizations::SizerRemoveItem(sizer_, end);
+                }
+            }
+            std::erase_if(entries_, [&keep](Entry const& entry) { return !keep.contains(entry.key); });
+        }
+
+        // Moves the `count` items starting at `from` so they sit just before
+        // the item currently at `before`.
+        void moveItems(size_t from, size_t count, size_t before)
+        {
+            if (from == before || from + count == before) {
+                return;
+            }
+            if (from < before) {
+                for (auto n = count; n-- > 0;) {
+                    customizations::SizerMoveItem(sizer_, from + n, before - count + n);
+                }
+            } else {
+                for (auto n = size_t { 0 }; n < count; ++n) {
+                    customizations::SizerMoveItem(sizer_, from + n, before + n);
+                }
+            }
+        }
+
+        [[nodiscard]] auto itemCount() const -> size_t
+        {
+            auto count = size_t { 0 };
+            for (auto const& entry : entries_) {
+                count += entry.count;
+            }
+            return count;
+        }
+
+        // Remembers where the block starts by holding on to the items at
+        // its edges: its first item (or, when it is empty, the item after
+        // it) and the item before it.  An empty block with nothing after it
+        // can only be found from the item before it, so items added right
+        // behind that one are taken to be in front of the block.
+        void track(size_t start)
+        {
+            offset_ = start;
+            first_ = start < customizations::SizerItemCount(sizer_) ? customizations::SizerItemHandle(sizer_, start) : nullptr;
+            previous_ = start > 0 ? customizations::SizerItemHandle(sizer_, start - 1) : nullptr;
+        }
+
+        // Where the block starts now, which moves when items in front of it
+        // are added or removed.
+        [[nodiscard]] auto blockStart() const -> size_t
+        {
+            auto count = customizations::SizerItemCount(sizer_);
+            if (first_ != nullptr) {
+                if (auto index = customizations::SizerItemIndex(sizer_, first_); index < count) {
+                    return index;
+                }
+            }
+            if (previous_ != nullptr) {
+                if (auto index = customizations::SizerItemIndex(sizer_, previous_); index < count) {
+                    return index + 1;
+                }
+            }
+            return std::min(offset_, count);
+        }
+
+        Parent* parent_;
+        Sizer* sizer_;
+        wxSizerFlags flags_;
+        KeyFunction keyFunction_;
+        Function createFunction_;
+        size_t offset_;
+        void const* first_ {};
+        void const* previous_ {};
+        std::vector<Entry> entries_;
+    };
+
+}
+
+// Like ForEach, but every item has a key so that the items can later be
+// updated through a KeyedForEachProxy without rebuilding the whole layout.
+template <std::ranges::input_range Range, typename KeyFunction, typename Function>
+requires(details::ForEachFunction<Function, std::ranges::range_value_t<Range>>)
+struct KeyedForEach {
+    using value_type = std::remove_cvref_t<std::ranges::range_value_t<Range>>;
+
+    KeyedForEach(Range&& args, KeyFunction&& keyFunction, Function&& createFunction)
+        : args_(std::forward<Range>(args))
+        , keyFunction_(std::forward<KeyFunction>(keyFunction))
+        , createFunction_(std::forward<Function>(createFunction))
+    {
+    }
+
+    KeyedForEach(wxSizerFlags const& flags, Range&& args, KeyFunction&& keyFunction, Function&& createFunction)
+        : flags_(flags)
+        , args_(std::forward<Range>(args))
+        , keyFunction_(std::forward<KeyFunction>(keyFunction))
+        , createFunction_(std::forward<Function>(createFunction))
+    {
+    }
+
+    auto withProxy(KeyedForEachProxy<value_type> const& proxy) & -> KeyedForEach&
+    {
+        proxyHandles_.push_back(proxy);
+        return *this;
+    }
+
+    auto withProxy(KeyedForEachProxy<value_type> const& proxy) && -> KeyedForEach&&
+    {
+        proxyHandles_.push_back(proxy);
+        return std::move(*this);
+    }
+
+    template <typename Parent, typename Sizer>
+    void createAndAdd(Parent* parent, Sizer* parentSizer, wxSizerFlags const& parentFlags)
+    {
+        using Reconciler = details::KeyedForEachReconciler<value_type, Parent, Sizer, std::decay_t<KeyFunction>, std::decay_t<Function>>;
+        auto reconciler = std::make_shared<Reconciler>(parent, parentSizer, flags_.value_or(parentFlags), keyFunction_, createFunction_);
+        reconciler->createAll(args_);
+        if (proxyHandles_.empty()) {
+            return;
+        }
+        for (auto& proxyHandle : proxyHandles_) {
+            proxyHandle.setReconciler([weak = std::weak_ptr { reconciler }](std::vector<value_type> const& values) {
+                auto reconciler = weak.lock();
+                if (!reconciler) {
+                    throw std::runtime_error("KeyedForEach: the window it was created in has been destroyed");
+                }
+                reconciler->update(values);
+            });
+        }
+        // The reconciler points at the parent and its sizer, so it goes
+        // with the parent.
+        customizations::WindowBindDestroy(parent, [reconciler]() mutable { reconciler.reset(); });
+    }
+
+private:
+    std::optional<wxSizerFlags> flags_ {};
+    Range args_;
+    KeyFunction keyFunction_;
+    Function createFunction_;
+    std::vector<KeyedForEachProxy<value_type>> proxyHandles_ {};
+};
+
+template <std::ranges::input_range Range, typename KeyFunction, typename Function>
+KeyedForEach(Range&&, KeyFunction&&, Function&&) -> KeyedForEach<Range, KeyFunction, Function>;
+
+template <std::ranges::input_range Range, typename KeyFunction, typename Function>
+KeyedForEach(wxSizerFlags const& flags, Range&&, KeyFunction&&, Function&&) -> KeyedForEach<Range, KeyFunction, Function>;
+
+template <typename T, typename KeyFunction, typename Function>
+KeyedForEach(std::initializer_list<T>, KeyFunction&&, Function&&) -> KeyedForEach<std::vector<T>, KeyFunction, Function>;
+
+template <typename T, typename KeyFunction, typename Function>
+KeyedForEach(wxSizerFlags const& flags, std::initializer_list<T>, KeyFunction&&, Function&&) -> KeyedForEach<std::vector<T>, KeyFunction, Function>;
+
 template <typename T, typename Function>
 auto VForEach(std::initializer_list<T> args, Function&& function)
 {
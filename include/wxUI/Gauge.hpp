@@ -25,6 +25,7 @@ SOFTWARE.
 
 #include <wx/gauge.h>
 #include <wxUI/GetterSetter.hpp>
+#include <wxUI/ProgressReporter.hpp>
 #include <wxUI/Widget.hpp>
 
 #include <wxUI/detail/HelperMacros.hpp>
@@ -60,6 +61,7 @@ struct Gauge {
         {
             auto* controller = control();
             return details::GetterSetter {
+                controller,
                 [controller] { return static_cast<int>(controller->GetValue()); },
                 [controller](int value) { controller->SetValue(value); }
             };
@@ -68,11 +70,15 @@ struct Gauge {
         {
             auto* controller = control();
             return details::GetterSetter {
+                controller,
                 [controller] { return static_cast<int>(controller->GetRange()); },
                 [controller](int range) { controller->SetRange(range); }
             };
         }
 
+        // For updating the gauge from worker threads; see ProgressReporter.
+        [[nodiscard]] auto progress() const { return ProgressReporter::create(*this); }
+
         auto operator*() const { return value(); }
     };
 
@@ -23,12 +23,172 @@ SOFTWARE.
 */
 #pragma once
 
+#include <wxUI/Customizations.hpp>
+
+#include <any>
 #include <functional>
 #include <istream>
+#include <map>
 #include <ostream>
+#include <utility>
+#include <vector>
 
 namespace wxUI::details {
 
+// Where a write through an accessor lands: the control, and a way to tell
+// whether it sits in a given window.  Accessors made without a control have
+// an empty target.
+struct WriteTarget {
+    void* control {};
+    auto (*within)(void* control, void const* window) -> bool {};
+};
+
+template <typename Window>
+auto isWithin(Window* window, void const* ancestor) -> bool
+{
+    if (window == nullptr) {
+        return false;
+    }
+    if (static_cast<void const*>(window) == ancestor) {
+        return true;
+    }
+    return isWithin(customizations::WindowParent(window), ancestor);
+}
+
+template <typename Controller>
+auto writeTarget(Controller* control) -> WriteTarget
+{
+    return {
+        control,
+        [](void* control, void const* window) { return isWithin(static_cast<Controller*>(control), window); },
+    };
+}
+
+// A WriteSink collects writes made through GetterSetters instead of letting
+// them reach the control straight away.  wxUI::Transaction installs one for
+// the controls in its window, and the Proxy returned from wxUI::post one for
+// its control.
+struct WriteSink {
+    WriteSink() = default;
+    WriteSink(WriteSink const&) = delete;
+    WriteSink(WriteSink&&) = delete;
+    auto operator=(WriteSink const&) -> WriteSink& = delete;
+    auto operator=(WriteSink&&) -> WriteSink& = delete;
+    virtual ~WriteSink() = default;
+    // `accessor` is the same for every write through the same accessor, and
+    // nullptr for edits that must all be applied (see applyOrQueueEdit).
+    virtual void defer(WriteTarget const& target, void const* accessor, std::function<void()> write) = 0;
+    // Where the sink keeps the value last written through `accessor` of
+    // `target`, so that compound assignments can build on it; nullptr if it
+    // does not keep track.
+    virtual auto pending(WriteTarget const& /*target*/, void const* /*accessor*/) -> std::any* { return nullptr; }
+};
+
+// The sink of a wxUI::Transaction.  Open Transactions form a list on their
+// thread, innermost first; each takes the writes to controls in its window.
+struct TransactionSink : WriteSink {
+    explicit TransactionSink(void const* window)
+        : window(window)
+    {
+    }
+
+    auto pending(WriteTarget const& target, void const* accessor) -> std::any* override
+    {
+        // Without a control, different objects' accessors can share a key.
+        if (target.control == nullptr) {
+            return nullptr;
+        }
+        return &pendingValues[{ target.control, accessor }];
+    }
+
+    void const* window;
+    TransactionSink* outer {};
+    std::map<std::pair<void const*, void const*>, std::any> pendingValues;
+};
+
+inline auto currentTransaction() -> TransactionSink*&
+{
+    thread_local TransactionSink* transaction = nullptr;
+    return transaction;
+}
+
+// The sink of a wxUI::post.  Live Posted objects form a list on their
+// thread, innermost first; each takes the writes to its own control.
+struct PostSink : WriteSink {
+    explicit PostSink(void const* control)
+        : control(control)
+    {
+    }
+
+    void const* control;
+    PostSink* outer {};
+};
+
+inline auto currentPost() -> PostSink*&
+{
+    thread_local PostSink* post = nullptr;
+    return post;
+}
+
+// The innermost Transaction whose window holds the control, failing that
+// the innermost Posted for the control.  Writes without a control go to the
+// innermost of either kind.
+inline auto sinkFor(WriteTarget const& target) -> WriteSink*
+{
+    for (auto* transaction = currentTransaction(); transaction != nullptr; transaction = transaction->outer) {
+        if (target.control == nullptr || target.within(target.control, transaction->window)) {
+            return transaction;
+        }
+    }
+    for (auto* post = currentPost(); post != nullptr; post = post->outer) {
+        if (target.control == nullptr || target.control == post->control) {
+            return post;
+        }
+    }
+    return nullptr;
+}
+
+template <typename Setter>
+inline constexpr char kAccessorKey {};
+
+template <typename Type, typename Setter>
+void applyOrQueue(WriteTarget const& target, Setter& setter, Type value)
+{
+    if (auto* sink = sinkFor(target)) {
+        if (auto* pending = sink->pending(target, &kAccessorKey<Setter>)) {
+            *pending = value;
+        }
+        sink->defer(target, &kAccessorKey<Setter>, [setter, value = std::move(value)]() mutable { setter(value); });
+    } else {
+        setter(value);
+    }
+}
+
+// The value a compound assignment starts from: the last write still queued
+// through this accessor, or else what the control holds.
+template <typename Type, typename Setter, typename Getter>
+auto latestValue(WriteTarget const& target, Getter const& getter) -> Type
+{
+    if (auto* sink = sinkFor(target)) {
+        if (auto* pending = sink->pending(target, &kAccessorKey<Setter>); pending != nullptr && pending->has_value()) {
+            return std::any_cast<Type>(*pending);
+        }
+    }
+    return getter();
+}
+
+// For writes that are not idempotent, such as inserting text: queued like
+// accessor writes, but never replaced by a later one.
+template <typename Edit>
+void applyOrQueueEdit(WriteTarget const& target, Edit edit)
+{
+    if (auto* sink = sinkFor(target)) {
+        sink->defer(target, nullptr, std::move(edit));
+    } else {
+        edit();
+    }
+}
+
 // why is this Enable here?  Because we need to specialize on the type without over constraining.
 template <typename Type, typename Getter, typename Setter, class Enable = void>
 struct GetterSetter {
@@ -43,6 +203,14 @@ struct GetterSetter {
     {
     }
 
+    template <typename Controller>
+    GetterSetter(Controller* control, Getter getter, Setter setter)
+        : getter_(getter)
+        , setter_(setter)
+        , target_(writeTarget(control))
+    {
+    }
+
     [[nodiscard]] auto get() const -> Type
     {
         return getter_();
@@ -57,12 +225,12 @@ struct GetterSetter {
 
     void set(Type const& value)
     {
-        setter_(value);
+        applyOrQueue<Type>(target_, setter_, value);
     }
 
     auto operator=(Type const& value) -> GetterSetter&
     {
-        setter_(value);
+        applyOrQueue<Type>(target_, setter_, value);
         return *this;
     }
 
@@ -87,14 +255,23 @@ struct GetterSetter {
     }
 
 private:
+    auto latest() const -> Type
+    {
+        return latestValue<Type, Setter>(target_, getter_);
+    }
+
     Getter getter_;
     Setter setter_;
+    WriteTarget target_ {};
 };
 
 // CTAD for GetterSetter
 template <typename Getter, typename Setter>
 GetterSetter(Getter, Setter) -> GetterSetter<std::invoke_result_t<Getter>, Getter, Setter>;
 
+template <typename Controller, typename Getter, typename Setter>
+GetterSetter(Controller*, Getter, Setter) -> GetterSetter<std::invoke_result_t<Getter>, Getter, Setter>;
+
 // Specialize for bool
 
 // This implemention supports logic operations for bools only
@@ -112,6 +289,14 @@ struct GetterSetter<bool, Getter, Setter> {
     {
     }
 
+    template <typename Controller>
+    GetterSetter(Controller* control, Getter getter, Setter setter)
+        : getter_(getter)
+        , setter_(setter)
+        , target_(writeTarget(control))
+    {
+    }
+
     [[nodiscard]] auto get() const -> Type
     {
         return getter_();
@@ -126,30 +311,30 @@ struct GetterSetter<bool, Getter, Setter> {
 
     void set(Type value)
     {
-        setter_(value);
+        applyOrQueue<Type>(target_, setter_, value);
     }
 
     auto operator=(Type value) -> GetterSetter&
     {
-        setter_(value);
+        applyOrQueue<Type>(target_, setter_, value);
         return *this;
     }
 
     auto operator&=(Type value) -> GetterSetter&
     {
-        setter_(getter_() & value);
+        applyOrQueue<Type>(target_, setter_, latest() & value);
         return *this;
     }
 
     auto operator^=(Type value) -> GetterSetter&
     {
-        setter_(getter_() ^ value);
+        applyOrQueue<Type>(target_, setter_, latest() ^ value);
         return *this;
     }
 
     auto operator|=(Type value) -> GetterSetter&
     {
-        setter_(getter_() | value);
+        applyOrQueue<Type>(target_, setter_, latest() | value);
         return *this;
     }
 
@@ -174,8 +359,14 @@ struct GetterSetter<bool, Getter, Setter> {
     }
 
 private:
+    auto latest() const -> Type
+    {
+        return latestValue<Type, Setter>(target_, getter_);
+    }
+
     Getter getter_;
     Setter setter_;
+    WriteTarget target_ {};
 };
 
 // Specialize for integral types
@@ -195,6 +386,14 @@ struct GetterSetter<Type, Getter, Setter> {
     {
     }
 
+    template <typename Controller>
+    GetterSetter(Controller* control, Getter getter, Setter setter)
+        : getter_(getter)
+        , setter_(setter)
+        , target_(writeTarget(control))
+    {
+    }
+
     [[nodiscard]] auto get() const -> Type
     {
         return getter_();
@@ -209,98 +408,98 @@ struct GetterSetter<Type, Getter, Setter> {
 
     void set(Type value)
     {
-        setter_(value);
+        applyOrQueue<Type>(target_, setter_, value);
     }
 
     auto operator=(Type value) -> GetterSetter&
     {
-        setter_(value);
+        applyOrQueue<Type>(target_, setter_, value);
         return *this;
     }
 
     auto operator+=(Type value) -> GetterSetter&
     {
-        setter_(getter_() + value);
+        applyOrQueue<Type>(target_, setter_, latest() + value);
         return *this;
     }
 
     auto operator-=(Type value) -> GetterSetter&
     {
-        setter_(getter_() - value);
+        applyOrQueue<Type>(target_, setter_, latest() - value);
         return *this;
     }
 
     auto operator*=(Type value) -> GetterSetter&
     {
-        setter_(getter_() * value);
+        applyOrQueue<Type>(target_, setter_, latest() * value);
         return *this;
     }
 
     auto operator/=(Type value) -> GetterSetter&
     {
-        setter_(getter_() / value);
+        applyOrQueue<Type>(target_, setter_, latest() / value);
         return *this;
     }
 
     auto operator%=(Type value) -> GetterSetter&
     {
-        setter_(getter_() % value);
+        applyOrQueue<Type>(target_, setter_, latest() % value);
         return *this;
     }
 
     auto operator<<=(Type value) -> GetterSetter&
     {
-        setter_(getter_() << value);
+        applyOrQueue<Type>(target_, setter_, latest() << value);
         return *this;
     }
 
     auto operator>>=(Type value) -> GetterSetter&
     {
-        setter_(getter_() >> value);
+        applyOrQueue<Type>(target_, setter_, latest() >> value);
         return *this;
     }
 
     auto operator&=(Type value) -> GetterSetter&
     {
-        setter_(getter_() & value);
+        applyOrQueue<Type>(target_, setter_, latest() & value);
         return *this;
     }
 
     auto operator^=(Type value) -> GetterSetter&
     {
-        setter_(getter_() ^ value);
+        applyOrQueue<Type>(target_, setter_, latest() ^ value);
         return *this;
     }
 
     auto operator|=(Type value) -> GetterSetter&
     {
-        setter_(getter_() | value);
+        applyOrQueue<Type>(target_, setter_, latest() | value);
         return *this;
     }
 
     auto operator++() -> GetterSetter&
     {
-        setter_(getter_() + 1);
+        applyOrQueue<Type>(target_, setter_, latest() + 1);
         return *this;
     }
 
     auto operator++(int) -> Type
     {
-        auto result = getter_();
-        setter_(result + 1);
+        auto result = latest();
+        applyOrQueue<Type>(target_, setter_, result + 1);
         return result;
     }
 
     auto operator--() -> GetterSetter&
     {
-        setter_(getter_() - 1);
+        applyOrQueue<Type>(target_, setter_, latest() - 1);
         return *this;
     }
 
     auto operator--(int) -> Type
     {
-        auto result = getter_();
-        setter_(result - 1);
+        auto result = latest();
+        applyOrQueue<Type>(target_, setter_, result - 1);
         return result;
     }
 
@@ -325,8 +524,14 @@ struct GetterSetter<Type, Getter, Setter> {
     }
 
 private:
+    auto latest() const -> Type
+    {
+        return latestValue<Type, Setter>(target_, getter_);
+    }
+
     Getter getter_;
     Setter setter_;
+    WriteTarget target_ {};
 };
 
 // Specialize for Float types
@@ -346,6 +551,14 @@ struct GetterSetter<Type, Getter, Setter> {
     {
     }
 
+    template <typename Controller>
+    GetterSetter(Controller* control, Getter getter, Setter setter)
+        : getter_(getter)
+        , setter_(setter)
+        , target_(writeTarget(control))
+    {
+    }
+
     [[nodiscard]] auto get() const -> Type
     {
         return getter_();
@@ -360,62 +573,62 @@ struct GetterSetter<Type, Getter, Setter> {
 
     void set(Type value)
     {
-        setter_(value);
+        applyOrQueue<Type>(target_, setter_, value);
     }
 
     auto operator=(Type value) -> GetterSetter&
     {
-        setter_(value);
+        applyOrQueue<Type>(target_, setter_, value);
         return *this;
     }
 
     auto operator+=(Type value) -> GetterSetter&
     {
-        setter_(getter_() + value);
+        applyOrQueue<Type>(target_, setter_, latest() + value);
         return *this;
     }
 
     auto operator-=(Type value) -> GetterSetter&
     {
-        setter_(getter_() - value);
+        applyOrQueue<Type>(target_, setter_, latest() - value);
         return *this;
     }
 
     auto operator*=(Type value) -> GetterSetter&
     {
-        setter_(getter_() * value);
+        applyOrQueue<Type>(target_, setter_, latest() * value);
         return *this;
     }
 
     auto operator/=(Type value) -> GetterSetter&
     {
-        setter_(getter_() / value);
+        applyOrQueue<Type>(target_, setter_, latest() / value);
         return *this;
     }
 
     auto operator++() -> GetterSetter&
     {
-        setter_(getter_() + 1);
+        applyOrQueue<Type>(target_, setter_, latest() + 1);
         return *this;
     }
 
     auto operator++(int) -> Type
     {
-        auto result = getter_();
-        setter_(result + 1);
+        auto result = latest();
+        applyOrQueue<Type>(target_, setter_, result + 1);
         return result;
     }
 
     auto operator--() -> GetterSetter&
     {
-        setter_(getter_() - 1);
+        applyOrQueue<Type>(target_, setter_, latest() - 1);
         return *this;
     }
 
     auto operator--(int) -> Type
     {
-        auto result = getter_();
-        setter_(result - 1);
+        auto result = latest();
+        applyOrQueue<Type>(target_, setter_, result - 1);
         return result;
     }
 
@@ -440,8 +653,14 @@ struct GetterSetter<Type, Getter, Setter> {
     }
 
 private:
+    auto latest() const -> Type
+    {
+        return latestValue<Type, Setter>(target_, getter_);
+    }
+
     Getter getter_;
     Setter setter_;
+    WriteTarget target_ {};
 };
 
 }
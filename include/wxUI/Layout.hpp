@@ -83,6 +83,7 @@ struct VSizer {
     WXUI_FITTO_DETAILS()
     WXUI_FORWARD_TO_DETAILS(VSizer, withFlags, wxSizerFlags, flags)
     WXUI_FORWARD_TO_DETAILS(VSizer, withProxy, SizerProxy, proxy)
+    WXUI_FORWARD_NOARG_TO_DETAILS(VSizer, withDispatcher)
 
 private:
     details::BoxSizer<Items...> details_;
@@ -153,6 +154,7 @@ struct HSizer {
     WXUI_FITTO_DETAILS()
     WXUI_FORWARD_TO_DETAILS(HSizer, withFlags, wxSizerFlags, flags)
     WXUI_FORWARD_TO_DETAILS(HSizer, withProxy, SizerProxy, proxy)
+    WXUI_FORWARD_NOARG_TO_DETAILS(HSizer, withDispatcher)
 
 private:
     details::BoxSizer<Items...> details_;
@@ -199,6 +201,7 @@ struct VWrapSizer {
     WXUI_FITTO_DETAILS()
     WXUI_FORWARD_TO_DETAILS(VWrapSizer, withFlags, wxSizerFlags, flags)
     WXUI_FORWARD_TO_DETAILS(VWrapSizer, withProxy, SizerProxy, proxy)
+    WXUI_FORWARD_NOARG_TO_DETAILS(VWrapSizer, withDispatcher)
 
 private:
     details::BoxSizer<Items...> details_;
@@ -233,6 +236,7 @@ struct HWrapSizer {
     WXUI_FITTO_DETAILS()
     WXUI_FORWARD_TO_DETAILS(HWrapSizer, withFlags, wxSizerFlags, flags)
     WXUI_FORWARD_TO_DETAILS(HWrapSizer, withProxy, SizerProxy, proxy)
+    WXUI_FORWARD_NOARG_TO_DETAILS(HWrapSizer, withDispatcher)
 
 private:
     details::BoxSizer<Items...> details_;
@@ -244,50 +248,71 @@ HWrapSizer(UItems&&... items) -> HWrapSizer<UItems...>;
 template <details::SizerItem... UItems>
 HWrapSizer(wxSizerFlags const& flags, UItems&&... items) -> HWrapSizer<UItems...>;
 
+namespace details {
+// How the grid sizers make their wxSizer, kept out of the Items... templates
+// like BoxSizerCreator.
+struct GridSizerCreator {
+    int cols = 0;
+
+    template <typename Parent>
+    auto operator()(Parent* parent) const
+    {
+        using ::wxUI::customizations::GridSizerInfo;
+        using ::wxUI::customizations::SizerCreate;
+        return SizerCreate(parent, GridSizerInfo { cols });
+    }
+};
+
+struct FlexGridSizerCreator {
+    int cols = 0;
+    std::vector<std::pair<size_t, int>> flexibleRows;
+    std::vector<std::pair<size_t, int>> flexibleCols;
+
+    template <typename Parent>
+    auto operator()(Parent* parent) const
+    {
+        using ::wxUI::customizations::FlexGridSizerInfo;
+        using ::wxUI::customizations::SizerCreate;
+        return SizerCreate(parent, FlexGridSizerInfo { cols, flexibleRows, flexibleCols });
+    }
+};
+}
+
 template <details::SizerItem... Items>
 struct GridSizer {
     template <details::SizerItem... UItems>
     explicit GridSizer(int cols, UItems&&... items)
         : details_(std::forward<UItems>(items)...)
-        , cols_(cols)
+        , creator_ { cols }
     {
     }
 
     template <details::SizerItem... UItems>
     GridSizer(int cols, wxSizerFlags const& flags, UItems&&... items)
         : details_(flags, std::forward<UItems>(items)...)
-        , cols_(cols)
+        , creator_ { cols }
     {
     }
 
     template <typename Parent, typename Sizer>
     auto createAndAdd(Parent* parent, Sizer* sizer, wxSizerFlags const& parentFlags)
     {
-        return details_.createAndAdd(this->template createImpl<Parent>(), parent, sizer, parentFlags);
+        return details_.createAndAdd(creator_, parent, sizer, parentFlags);
     }
 
     template <typename Parent>
     auto fitTo(Parent* parent) -> Parent*
     {
-        return details_.fitTo(this->template createImpl<Parent>(), parent);
+        return details_.fitTo(creator_, parent);
     }
 
     WXUI_FORWARD_TO_DETAILS(GridSizer, withFlags, wxSizerFlags, flags)
     WXUI_FORWARD_TO_DETAILS(GridSizer, withProxy, SizerProxy, proxy)
+    WXUI_FORWARD_NOARG_TO_DETAILS(GridSizer, withDispatcher)
 
 private:
-    template <typename Parent>
-    auto createImpl()
-    {
-        return [this](Parent* parent) {
-            using ::wxUI::customizations::GridSizerInfo;
-            using ::wxUI::customizations::SizerCreate;
-            return SizerCreate(parent, GridSizerInfo { cols_ });
-        };
-    }
-
     details::Sizer<Items...> details_;
-    int cols_ = 0;
+    details::GridSizerCreator creator_;
 };
 
 template <details::SizerItem... UItems>
@@ -301,71 +326,60 @@ struct FlexGridSizer {
     template <details::SizerItem... UItems>
     explicit FlexGridSizer(int cols, UItems&&... items)
         : details_(std::forward<UItems>(items)...)
-        , cols_(cols)
+        , creator_ { cols, {}, {} }
     {
     }
 
     template <details::SizerItem... UItems>
     FlexGridSizer(int cols, wxSizerFlags const& flags, UItems&&... items)
         : details_(flags, std::forward<UItems>(items)...)
-        , cols_(cols)
+        , creator_ { cols, {}, {} }
     {
     }
 
     auto withFlexibleRow(size_t row, int proportion) & -> FlexGridSizer&
     {
-        flexibleRows_.emplace_back(row, proportion);
+        creator_.flexibleRows.emplace_back(row, proportion);
         return *this;
     }
 
     auto withFlexibleRow(size_t row, int proportion) && -> FlexGridSizer&&
     {
-        flexibleRows_.emplace_back(row, proportion);
+        creator_.flexibleRows.emplace_back(row, proportion);
         return std::move(*this);
     }
 
     auto withFlexibleCol(size_t col, int proportion) & -> FlexGridSizer&
     {
-        flexibleCols_.emplace_back(col, proportion);
+        creator_.flexibleCols.emplace_back(col, proportion);
         return *this;
     }
 
     auto withFlexibleCol(size_t col, int proportion) && -> FlexGridSizer&&
     {
-        flexibleCols_.emplace_back(col, proportion);
+        creator_.flexibleCols.emplace_back(col, proportion);
         return std::move(*this);
     }
 
     template <typename Parent, typename Sizer>
     auto createAndAdd(Parent* parent, Sizer* sizer, wxSizerFlags const& parentFlags)
     {
-        return details_.createAndAdd(this->template createImpl<Parent>(), parent, sizer, parentFlags);
+        return details_.createAndAdd(creator_, parent, sizer, parentFlags);
     }
 
     template <typename Parent>
     auto fitTo(Parent* parent) -> Parent*
     {
-        return details_.fitTo(this->template createImpl<Parent>(), parent);
+        return details_.fitTo(creator_, parent);
     }
 
     WXUI_FORWARD_TO_DETAILS(FlexGridSizer, withFlags, wxSizerFlags, flags)
     WXUI_FORWARD_TO_DETAILS(FlexGridSizer, withProxy, SizerProxy, proxy)
+    WXUI_FORWARD_NOARG_TO_DETAILS(FlexGridSizer, withDispatcher)
 
 private:
-    template <typename Parent>
-    auto createImpl()
-    {
-        return [this](Parent* parent) {
-            using ::wxUI::customizations::FlexGridSizerInfo;
-            using ::wxUI::customizations::SizerCreate;
-            return SizerCreate(parent, FlexGridSizerInfo { cols_, flexibleRows_, flexibleCols_ });
-        };
-    }
-
     details::Sizer<Items...> details_;
-    int cols_ = 0;
-    std::vector<std::pair<size_t, int>> flexibleRows_;
-    std::vector<std::pair<size_t, int>> flexibleCols_;
+    details::FlexGridSizerCreator creator_;
 };
 
 template <details::SizerItem... UItems>
@@ -31,7 +31,7 @@ template <details::SizerItem... Items>
 struct LayoutIf {
     template <details::SizerItem... UItems>
     explicit LayoutIf(bool enabled, UItems&&... items)
-        : items_(std::forward_as_tuple(std::forward<UItems>(items)...))
+        : items_(std::in_place, std::forward<UItems>(items)...)
     {
         if (!enabled) {
             items_.reset();
@@ -43,20 +43,11 @@ struct LayoutIf {
         if (!items_) {
             return;
         }
-        createAndAddWidgets(parent, parentSizer, parentFlags);
+        items_->createAndAdd(parent, parentSizer, parentFlags);
     }
 
 private:
-    template <typename Parent, typename Sizer>
-    void createAndAddWidgets(Parent* parent, Sizer* sizer, wxSizerFlags const& flags)
-    {
-        std::apply([parent, sizer, flags](auto&&... tupleArg) {
-            (details::createAndAddVisiter(tupleArg, parent, sizer, flags), ...);
-        },
-            *items_);
-    }
-
-    std::optional<std::tuple<Items...>> items_ {};
+    std::optional<details::SizerItems<Items...>> items_ {};
 };
 
 template <details::SizerItem... Item>
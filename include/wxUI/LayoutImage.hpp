@@ -0,0 +1,740 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+
+#include <algorithm>
+#include <any>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <wxUI/Button.hpp>
+#include <wxUI/CheckBox.hpp>
+#include <wxUI/Choice.hpp>
+#include <wxUI/ComboBox.hpp>
+#include <wxUI/Gauge.hpp>
+#include <wxUI/Layout.hpp>
+#include <wxUI/Line.hpp>
+#include <wxUI/ListBox.hpp>
+#include <wxUI/Slider.hpp>
+#include <wxUI/SpinCtrl.hpp>
+#include <wxUI/Text.hpp>
+#include <wxUI/TextCtrl.hpp>
+#include <wxUI/detail/LayoutDetails.hpp>
+
+#if defined(_WIN32)
+#include <wx/msw/wrapwin.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace wxUI::details {
+
+// A read-only view of a whole file, mapped into memory.
+class FileMapping {
+public:
+    explicit FileMapping(std::filesystem::path const& path)
+    {
+#if defined(_WIN32)
+        auto file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Cannot open layout file " + path.string());
+        }
+        auto size = LARGE_INTEGER {};
+        auto mapping = HANDLE {};
+        if (::GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+            mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        }
+        ::CloseHandle(file);
+        if (mapping == nullptr) {
+            throw std::runtime_error("Cannot map layout file " + path.string());
+        }
+        // the view keeps the mapping alive once it is made.
+        data_ = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        ::CloseHandle(mapping);
+        if (data_ == nullptr) {
+            throw std::runtime_error("Cannot map layout file " + path.string());
+        }
+        size_ = static_cast<std::size_t>(size.QuadPart);
+#else
+        auto file = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (file < 0) {
+            throw std::runtime_error("Cannot open layout file " + path.string());
+        }
+        struct stat status {};
+        auto* data = MAP_FAILED;
+        if (::fstat(file, &status) == 0 && status.st_size > 0) {
+            data = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+        }
+        // the mapping stays valid after the file is closed.
+        ::close(file);
+        if (data == MAP_FAILED) {
+            throw std::runtime_error("Cannot map layout file " + path.string());
+        }
+        data_ = data;
+        size_ = static_cast<std::size_t>(status.st_size);
+#endif
+    }
+
+    ~FileMapping()
+    {
+        unmap();
+    }
+
+    FileMapping(FileMapping const&) = delete;
+    auto operator=(FileMapping const&) -> FileMapping& = delete;
+
+    FileMapping(FileMapping&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr))
+        , size_(std::exchange(other.size_, 0))
+    {
+    }
+
+    auto operator=(FileMapping&& other) noexcept -> FileMapping&
+    {
+        if (this != &other) {
+            unmap();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    [[nodiscard]] auto bytes() const -> std::span<std::byte const>
+    {
+        return { static_cast<std::byte const*>(data_), size_ };
+    }
+
+private:
+    void unmap() noexcept
+    {
+        if (data_ == nullptr) {
+            return;
+        }
+#if defined(_WIN32)
+        ::UnmapViewOfFile(data_);
+#else
+        ::munmap(data_, size_);
+#endif
+        data_ = nullptr;
+    }
+
+    void* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+// Layout images are little-endian whatever the host, and are read a byte at a
+// time so that nothing in them needs to be aligned.
+inline auto layoutImageLoad(std::span<std::byte const> bytes, std::size_t offset) -> std::uint32_t
+{
+    return static_cast<std::uint32_t>(bytes[offset])
+        | (static_cast<std::uint32_t>(bytes[offset + 1]) << 8U)
+        | (static_cast<std::uint32_t>(bytes[offset + 2]) << 16U)
+        | (static_cast<std::uint32_t>(bytes[offset + 3]) << 24U);
+}
+
+inline void layoutImageStore(std::vector<std::byte>& bytes, std::size_t offset, std::uint32_t value)
+{
+    for (auto byte = std::size_t {}; byte < 4; ++byte) {
+        bytes[offset + byte] = static_cast<std::byte>((value >> (8U * byte)) & 0xFFU);
+    }
+}
+
+}
+
+namespace wxUI {
+
+// LayoutImage describes a layout as data rather than as types, so that the
+// screens of an application can be shipped as files and built at run time
+// without a template instantiation each.  The image is a compact binary form:
+//
+//   header   "wxUL", version, then the count and offset of each table
+//   nodes    one fixed-size record per sizer, spacer or controller, in
+//            pre-order; a sizer's children are the records that follow it
+//   strings  offset and size of each UTF-8 string in the image
+//   choices  string indices, a run of which makes up the choices of a node
+//
+// LayoutImage does not own its bytes; it checks them once when constructed
+// and after that reads them in place.  Strings are only converted when the
+// layout is created, and the bytes are not needed after that.  Build images
+// with LayoutImage::serialize, and load them from files with MappedLayout.
+//
+// The controllers and sizers are made by the usual wxUI types, so they go
+// through the same customization points as a layout written in code.
+class LayoutImage {
+public:
+    enum class Kind : std::uint8_t {
+        VSizer = 1,
+        HSizer,
+        Spacer,
+        StretchSpacer,
+        Text,
+        Button,
+        CheckBox,
+        TextCtrl,
+        Choice,
+        ComboBox,
+        ListBox,
+        Slider,
+        SpinCtrl,
+        Gauge,
+        HLine,
+        VLine,
+    };
+
+    // The description LayoutImage::serialize writes.  `text` is the caption
+    // of a sizer or the label of a controller, and `proxy` names the proxy
+    // withProxy attaches.  `value` is the size of a Spacer or StretchSpacer,
+    // the selection of a Choice, ComboBox or ListBox, the check of a CheckBox
+    // or the initial value of a Slider or SpinCtrl.  `range` is the range of a
+    // Slider or SpinCtrl; a Gauge takes its range from the second value.
+    struct Node {
+        Kind kind {};
+        std::string text {};
+        std::string proxy {};
+        std::vector<std::string> choices {};
+        std::optional<wxSizerFlags> flags {};
+        std::optional<int> value {};
+        std::optional<std::pair<int, int>> range {};
+        std::vector<Node> children {};
+    };
+
+    static constexpr auto kVersion = std::uint32_t { 1 };
+
+    explicit LayoutImage(std::span<std::byte const> bytes)
+        : bytes_(bytes)
+    {
+        validate();
+    }
+
+    [[nodiscard]] auto bytes() const -> std::span<std::byte const> { return bytes_; }
+
+    // Attaches `proxy` to the sizer or controller that the image names `name`.
+    // Names the image uses but that are not given a proxy are ignored.
+    template <typename Underlying>
+    auto withProxy(std::string name, details::Proxy<Underlying> const& proxy) & -> LayoutImage&
+    {
+        proxies_.push_back({ std::move(name), proxy });
+        return *this;
+    }
+
+    template <typename Underlying>
+    auto withProxy(std::string name, details::Proxy<Underlying> const& proxy) && -> LayoutImage&&
+    {
+        proxies_.push_back({ std::move(name), proxy });
+        return std::move(*this);
+    }
+
+    template <typename Parent, typename Sizer>
+    void createAndAdd(Parent* parent, Sizer* sizer, wxSizerFlags const& parentFlags) const
+    {
+        createAndAddNode(0, parent, sizer, parentFlags);
+    }
+
+    template <typename Parent>
+    auto fitTo(Parent* parent) const -> Parent*
+    {
+        auto node = record(0);
+        if (node.kind != Kind::VSizer && node.kind != Kind::HSizer) {
+            throw std::runtime_error("Layout image needs a sizer at its root to be fitted to a window");
+        }
+        return NodeSizer { *this, node }.fitTo(parent);
+    }
+
+    static auto serialize(Node const& root) -> std::vector<std::byte>
+    {
+        auto writer = Writer {};
+        writer.add(root);
+        return writer.finish();
+    }
+
+private:
+    static constexpr auto kMagic = std::string_view { "wxUL" };
+    static constexpr auto kHeaderSize = std::size_t { 32 };
+    static constexpr auto kRecordSize = std::size_t { 48 };
+    static constexpr auto kStringSize = std::size_t { 8 };
+    static constexpr auto kNone = std::uint32_t { 0xFFFFFFFF };
+    static constexpr auto kMaxDepth = std::size_t { 256 };
+
+    static constexpr auto kHasFlags = std::uint8_t { 1U << 0U };
+    static constexpr auto kHasValue = std::uint8_t { 1U << 1U };
+    static constexpr auto kHasRange = std::uint8_t { 1U << 2U };
+
+    struct Header {
+        std::uint32_t nodeCount;
+        std::uint32_t nodes;
+        std::uint32_t stringCount;
+        std::uint32_t strings;
+        std::uint32_t choiceCount;
+        std::uint32_t choices;
+    };
+
+    // One node record as stored, and where it is.  extent is the number of
+    // records in the node's subtree after the node itself.
+    struct Record {
+        std::uint32_t index;
+        Kind kind;
+        std::uint8_t has;
+        std::uint32_t extent;
+        std::uint32_t text;
+        std::uint32_t proxy;
+        std::int32_t proportion;
+        std::int32_t flags;
+        std::int32_t border;
+        std::int32_t value;
+        std::int32_t rangeMin;
+        std::int32_t rangeMax;
+        std::uint32_t choicesFirst;
+        std::uint32_t choicesCount;
+    };
+
+    struct NamedProxy {
+        std::string name;
+        std::any proxy;
+    };
+
+    [[nodiscard]] auto load(std::size_t offset) const { return details::layoutImageLoad(bytes_, offset); }
+
+    [[nodiscard]] auto header() const -> Header
+    {
+        return { load(8), load(12), load(16), load(20), load(24), load(28) };
+    }
+
+    [[nodiscard]] auto recordOffset(std::uint32_t index) const -> std::size_t
+    {
+        return header_.nodes + std::size_t { index } * kRecordSize;
+    }
+
+    [[nodiscard]] auto record(std::uint32_t index) const -> Record
+    {
+        auto offset = recordOffset(index);
+        return {
+            .index = index,
+            .kind = static_cast<Kind>(bytes_[offset]),
+            .has = static_cast<std::uint8_t>(bytes_[offset + 1]),
+            .extent = load(offset + 4),
+            .text = load(offset + 8),
+            .proxy = load(offset + 12),
+            .proportion = static_cast<std::int32_t>(load(offset + 16)),
+            .flags = static_cast<std::int32_t>(load(offset + 20)),
+            .border = static_cast<std::int32_t>(load(offset + 24)),
+            .value = static_cast<std::int32_t>(load(offset + 28)),
+            .rangeMin = static_cast<std::int32_t>(load(offset + 32)),
+            .rangeMax = static_cast<std::int32_t>(load(offset + 36)),
+            .choicesFirst = load(offset + 40),
+            .choicesCount = load(offset + 44),
+        };
+    }
+
+    [[nodiscard]] auto stringAt(std::uint32_t index) const -> std::string_view
+    {
+        if (index == kNone) {
+            return {};
+        }
+        auto entry = header_.strings + std::size_t { index } * kStringSize;
+        return { reinterpret_cast<char const*>(bytes_.data() + load(entry)), load(entry + 4) };
+    }
+
+    [[nodiscard]] auto text(Record const& node) const { return details::toWxString(stringAt(node.text)); }
+
+    [[nodiscard]] auto choices(Record const& node) const -> std::vector<wxString>
+    {
+        auto result = std::vector<wxString> {};
+        result.reserve(node.choicesCount);
+        for (auto choice = node.choicesFirst; choice < node.choicesFirst + node.choicesCount; ++choice) {
+            result.push_back(details::toWxString(stringAt(load(header_.choices + std::size_t { choice } * 4))));
+        }
+        return result;
+    }
+
+    [[nodiscard]] static auto sizerFlags(Record const& node) -> wxSizerFlags
+    {
+        auto flags = wxSizerFlags { node.proportion };
+        flags.Align(node.flags & wxALIGN_MASK);
+        flags.Border(node.flags & wxALL, node.border);
+        if ((node.flags & wxEXPAND) != 0) {
+            flags.Expand();
+        }
+        if ((node.flags & wxSHAPED) != 0) {
+            flags.Shaped();
+        }
+        if ((node.flags & wxFIXED_MINSIZE) != 0) {
+            flags.FixedMinSize();
+        }
+        if ((node.flags & wxRESERVE_SPACE_EVEN_IF_HIDDEN) != 0) {
+            flags.ReserveSpaceEvenIfHidden();
+        }
+        return flags;
+    }
+
+    template <typename Underlying>
+    [[nodiscard]] auto findProxy(Record const& node) const -> details::Proxy<Underlying> const*
+    {
+        if (node.proxy == kNone) {
+            return nullptr;
+        }
+        auto name = stringAt(node.proxy);
+        for (auto const& [proxyName, proxy] : proxies_) {
+            if (proxyName == name) {
+                if (auto const* typed = std::any_cast<details::Proxy<Underlying>>(&proxy)) {
+                    return typed;
+                }
+                throw std::runtime_error("Layout image proxy " + proxyName + " is not the type of the item it names");
+            }
+        }
+        return nullptr;
+    }
+
+    // A sizer record, made with the same parts as BoxSizer.
+    class NodeSizer : details::SizerBase {
+    public:
+        NodeSizer(LayoutImage const& image, Record const& node)
+            : image_(image)
+            , node_(node)
+            , creator_ { node.kind == Kind::VSizer ? wxVERTICAL : wxHORIZONTAL, false, std::nullopt }
+        {
+            if ((node.has & kHasFlags) != 0) {
+                flags_ = sizerFlags(node);
+            }
+            if (node.text != kNone) {
+                creator_.caption = image.text(node);
+            }
+            if (auto const* proxy = image.findProxy<wxSizer>(node)) {
+                proxyHandles_.push_back(*proxy);
+            }
+        }
+
+        template <typename Parent, typename Sizer>
+        auto createAndAdd(Parent* parent, Sizer* sizer, wxSizerFlags const& parentFlags)
+        {
+            auto children = Children { image_, node_ };
+            return createAndAddItems(creator_, children, parent, sizer, parentFlags);
+        }
+
+        template <typename Parent>
+        auto fitTo(Parent* parent) -> Parent*
+        {
+            auto children = Children { image_, node_ };
+            return fitItemsTo(creator_, children, parent);
+        }
+
+    private:
+        struct Children {
+            LayoutImage const& image;
+            Record const& node;
+
+            template <typename Parent, typename Sizer>
+            void createAndAdd(Parent* parent, Sizer* sizer, wxSizerFlags const& flags)
+            {
+                image.createAndAddChildren(node, parent, sizer, flags);
+            }
+        };
+
+        LayoutImage const& image_;
+        Record node_;
+        details::BoxSizerCreator creator_;
+    };
+
+    template <typename Parent, typename Sizer>
+    void createAndAddChildren(Record const& node, Parent* parent, Sizer* sizer, wxSizerFlags const& flags) const
+    {
+        auto end = node.index + node.extent + 1;
+        for (auto child = node.index + 1; child < end; child += load(recordOffset(child) + 4) + 1) {
+            createAndAddNode(child, parent, sizer, flags);
+        }
+    }
+
+    template <typename Parent, typename Sizer>
+    void createAndAddNode(std::uint32_t index, Parent* parent, Sizer* sizer, wxSizerFlags const& parentFlags) const
+    {
+        auto node = record(index);
+        auto hasValue = (node.has & kHasValue) != 0;
+        auto value = hasValue ? std::optional { node.value } : std::nullopt;
+        auto range = (node.has & kHasRange) != 0 ? std::optional { std::pair { node.rangeMin, node.rangeMax } } : std::nullopt;
+        switch (node.kind) {
+        case Kind::VSizer:
+        case Kind::HSizer:
+            NodeSizer { *this, node }.createAndAdd(parent, sizer, parentFlags);
+            break;
+        case Kind::Spacer:
+            sizer->AddSpacer(node.value);
+            break;
+        case Kind::StretchSpacer:
+            sizer->AddStretchSpacer(hasValue ? node.value : 1);
+            break;
+        case Kind::Text:
+            createAndAddController(Text { wxUI_String {}, text(node) }, node, parent, sizer, parentFlags);
+            break;
+        case Kind::Button:
+            createAndAddController(Button { wxUI_String {}, text(node) }, node, parent, sizer, parentFlags);
+            break;
+        case Kind::CheckBox:
+            createAndAddController(CheckBox { wxUI_String {}, text(node) }.withValue(hasValue && node.value != 0), node, parent, sizer, parentFlags);
+            break;
+        case Kind::TextCtrl:
+            createAndAddController(TextCtrl { wxUI_String {}, text(node) }, node, parent, sizer, parentFlags);
+            break;
+        case Kind::Choice:
+            createAndAddController(withSelection(Choice { choices(node) }, value), node, parent, sizer, parentFlags);
+            break;
+        case Kind::ComboBox:
+            createAndAddController(withSelection(ComboBox { choices(node) }, value), node, parent, sizer, parentFlags);
+            break;
+        case Kind::ListBox:
+            createAndAddController(withSelection(ListBox { choices(node) }, value), node, parent, sizer, parentFlags);
+            break;
+        case Kind::Slider:
+            createAndAddController(Slider { range, value }, node, parent, sizer, parentFlags);
+            break;
+        case Kind::SpinCtrl:
+            createAndAddController(SpinCtrl { range, value }, node, parent, sizer, parentFlags);
+            break;
+        case Kind::Gauge:
+            createAndAddController(range ? Gauge { Gauge::withRange {}, range->second } : Gauge {}, node, parent, sizer, parentFlags);
+            break;
+        case Kind::HLine:
+            createAndAddController(HLine(), node, parent, sizer, parentFlags);
+            break;
+        case Kind::VLine:
+            createAndAddController(VLine(), node, parent, sizer, parentFlags);
+            break;
+        }
+    }
+
+    template <typename Controller>
+    static auto withSelection(Controller controller, std::optional<int> selection) -> Controller
+    {
+        if (selection) {
+            controller.withSelection(*selection);
+        }
+        return controller;
+    }
+
+    template <typename Controller, typename Parent, typename Sizer>
+    void createAndAddController(Controller&& controller, Record const& node, Parent* parent, Sizer* sizer, wxSizerFlags const& parentFlags) const
+    {
+        if ((node.has & kHasFlags) != 0) {
+            controller.withFlags(sizerFlags(node));
+        }
+        if (auto const* proxy = findProxy<typename std::remove_cvref_t<Controller>::underlying_t>(node)) {
+            controller.withProxy(*proxy);
+        }
+        controller.createAndAdd(parent, sizer, parentFlags);
+    }
+
+    [[noreturn]] static void malformed(std::string const& what)
+    {
+        throw std::runtime_error("Malformed layout image: " + what);
+    }
+
+    // Checks everything that is later read without checking: the tables are
+    // inside the image, every index is in range, and the subtrees nest.
+    void validate()
+    {
+        auto size = std::uint64_t { bytes_.size() };
+        if (size < kHeaderSize) {
+            malformed("too small");
+        }
+        if (!std::ranges::equal(bytes_.first(kMagic.size()), kMagic, {}, {}, [](char c) { return static_cast<std::byte>(c); })) {
+            malformed("not a layout image");
+        }
+        if (load(4) != kVersion) {
+            malformed("unsupported version " + std::to_string(load(4)));
+        }
+        header_ = header();
+        auto inside = [size](std::uint32_t offset, std::uint32_t count, std::size_t each) {
+            return std::uint64_t { offset } + std::uint64_t { count } * each <= size;
+        };
+        if (header_.nodeCount == 0 || !inside(header_.nodes, header_.nodeCount, kRecordSize)) {
+            malformed("node table out of range");
+        }
+        if (!inside(header_.strings, header_.stringCount, kStringSize)) {
+            malformed("string table out of range");
+        }
+        if (!inside(header_.choices, header_.choiceCount, 4)) {
+            malformed("choice table out of range");
+        }
+        for (auto index = std::uint32_t {}; index < header_.stringCount; ++index) {
+            auto entry = header_.strings + std::size_t { index } * kStringSize;
+            if (!inside(load(entry), load(entry + 4), 1)) {
+                malformed("string " + std::to_string(index) + " out of range");
+            }
+        }
+        for (auto index = std::uint32_t {}; index < header_.choiceCount; ++index) {
+            if (load(header_.choices + std::size_t { index } * 4) >= header_.stringCount) {
+                malformed("choice " + std::to_string(index) + " out of range");
+            }
+        }
+        if (record(0).extent != header_.nodeCount - 1) {
+            malformed("root does not hold every node");
+        }
+        // the ends of the subtrees that are open at each record.
+        auto open = std::vector<std::uint64_t> {};
+        for (auto index = std::uint32_t {}; index < header_.nodeCount; ++index) {
+            auto node = record(index);
+            auto isSizer = node.kind == Kind::VSizer || node.kind == Kind::HSizer;
+            if (node.kind < Kind::VSizer || node.kind > Kind::VLine) {
+                malformed("node " + std::to_string(index) + " has unknown kind");
+            }
+            if ((node.text != kNone && node.text >= header_.stringCount) || (node.proxy != kNone && node.proxy >= header_.stringCount)) {
+                malformed("node " + std::to_string(index) + " names a string out of range");
+            }
+            if (std::uint64_t { node.choicesFirst } + node.choicesCount > header_.choiceCount) {
+                malformed("node " + std::to_string(index) + " has choices out of range");
+            }
+            while (!open.empty() && open.back() < index) {
+                open.pop_back();
+            }
+            auto end = std::uint64_t { index } + node.extent;
+            if ((!isSizer && node.extent != 0) || (!open.empty() && end > open.back())) {
+                malformed("node " + std::to_string(index) + " does not nest");
+            }
+            if (node.extent != 0) {
+                open.push_back(end);
+            }
+            if (open.size() > kMaxDepth) {
+                malformed("nested too deeply");
+            }
+        }
+    }
+
+    class Writer {
+    public:
+        void add(Node const& node)
+        {
+            if (!node.children.empty() && node.kind != Kind::VSizer && node.kind != Kind::HSizer) {
+                throw std::runtime_error("Only sizers can have children in a layout image");
+            }
+            auto index = records_.size() / kRecordSize;
+            auto offset = records_.size();
+            records_.resize(offset + kRecordSize);
+            auto flags = node.flags.value_or(wxSizerFlags {});
+            records_[offset] = static_cast<std::byte>(node.kind);
+            records_[offset + 1] = static_cast<std::byte>((node.flags ? kHasFlags : 0U) | (node.value ? kHasValue : 0U) | (node.range ? kHasRange : 0U));
+            details::layoutImageStore(records_, offset + 8, internName(node.text));
+            details::layoutImageStore(records_, offset + 12, internName(node.proxy));
+            details::layoutImageStore(records_, offset + 16, static_cast<std::uint32_t>(flags.GetProportion()));
+            details::layoutImageStore(records_, offset + 20, static_cast<std::uint32_t>(flags.GetFlags()));
+            details::layoutImageStore(records_, offset + 24, static_cast<std::uint32_t>(flags.GetBorderInPixels()));
+            details::layoutImageStore(records_, offset + 28, static_cast<std::uint32_t>(node.value.value_or(0)));
+            details::layoutImageStore(records_, offset + 32, static_cast<std::uint32_t>(node.range ? node.range->first : 0));
+            details::layoutImageStore(records_, offset + 36, static_cast<std::uint32_t>(node.range ? node.range->second : 0));
+            details::layoutImageStore(records_, offset + 40, static_cast<std::uint32_t>(choices_.size()));
+            details::layoutImageStore(records_, offset + 44, static_cast<std::uint32_t>(node.choices.size()));
+            for (auto const& choice : node.choices) {
+                choices_.push_back(intern(choice));
+            }
+            for (auto const& child : node.children) {
+                add(child);
+            }
+            details::layoutImageStore(records_, offset + 4, static_cast<std::uint32_t>(records_.size() / kRecordSize - index - 1));
+        }
+
+        auto finish() -> std::vector<std::byte>
+        {
+            auto nodes = kHeaderSize;
+            auto strings = nodes + records_.size();
+            auto choices = strings + strings_.size() * kStringSize;
+            auto text = choices + choices_.size() * 4;
+            auto image = std::vector<std::byte>(text + text_.size());
+            std::ranges::transform(kMagic, image.begin(), [](char c) { return static_cast<std::byte>(c); });
+            details::layoutImageStore(image, 4, kVersion);
+            details::layoutImageStore(image, 8, static_cast<std::uint32_t>(records_.size() / kRecordSize));
+            details::layoutImageStore(image, 12, static_cast<std::uint32_t>(nodes));
+            details::layoutImageStore(image, 16, static_cast<std::uint32_t>(strings_.size()));
+            details::layoutImageStore(image, 20, static_cast<std::uint32_t>(strings));
+            details::layoutImageStore(image, 24, static_cast<std::uint32_t>(choices_.size()));
+            details::layoutImageStore(image, 28, static_cast<std::uint32_t>(choices));
+            std::ranges::copy(records_, image.begin() + static_cast<std::ptrdiff_t>(nodes));
+            for (auto index = std::size_t {}; index < strings_.size(); ++index) {
+                details::layoutImageStore(image, strings + index * kStringSize, static_cast<std::uint32_t>(text + strings_[index].first));
+                details::layoutImageStore(image, strings + index * kStringSize + 4, static_cast<std::uint32_t>(strings_[index].second));
+            }
+            for (auto index = std::size_t {}; index < choices_.size(); ++index) {
+                details::layoutImageStore(image, choices + index * 4, choices_[index]);
+            }
+            std::ranges::transform(text_, image.begin() + static_cast<std::ptrdiff_t>(text), [](char c) { return static_cast<std::byte>(c); });
+            return image;
+        }
+
+    private:
+        // an empty text or proxy is stored as kNone, meaning the node has none.
+        auto internName(std::string const& string) -> std::uint32_t
+        {
+            return string.empty() ? kNone : intern(string);
+        }
+
+        // each distinct string is stored once.  A choice is always a string
+        // in the table, since an empty choice is still a choice.
+        auto intern(std::string const& string) -> std::uint32_t
+        {
+            auto [found, added] = indices_.try_emplace(string, static_cast<std::uint32_t>(strings_.size()));
+            if (added) {
+                strings_.emplace_back(text_.size(), string.size());
+                text_ += string;
+            }
+            return found->second;
+        }
+
+        std::vector<std::byte> records_ {};
+        std::vector<std::uint32_t> choices_ {};
+        std::vector<std::pair<std::size_t, std::size_t>> strings_ {};
+        std::map<std::string, std::uint32_t, std::less<>> indices_ {};
+        std::string text_ {};
+    };
+
+    std::span<std::byte const> bytes_;
+    Header header_ {};
+    std::vector<NamedProxy> proxies_ {};
+};
+
+// A LayoutImage read from a file.  The file is mapped into memory rather than
+// read, so only the pages a layout touches are loaded, and a file shared by
+// several processes is only in memory once.  The MappedLayout has to outlive
+// the creation of the layouts made from its image, but not the windows.
+class MappedLayout {
+public:
+    explicit MappedLayout(std::filesystem::path const& path)
+        : mapping_(path)
+        , image_(mapping_.bytes())
+    {
+    }
+
+    [[nodiscard]] auto image() const -> LayoutImage const& { return image_; }
+
+private:
+    details::FileMapping mapping_;
+    LayoutImage image_;
+};
+}
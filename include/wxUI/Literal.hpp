@@ -0,0 +1,93 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <string_view>
+#include <wx/string.h>
+
+namespace wxUI::details {
+
+// A string literal usable as a template argument.
+template <std::size_t N>
+struct FixedString {
+    // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions, cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+    constexpr FixedString(char const (&text)[N])
+    {
+        std::copy_n(text, N, data);
+    }
+
+    [[nodiscard]] constexpr auto view() const { return std::string_view { data, N - 1 }; }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+    char data[N] {};
+};
+
+}
+
+namespace wxUI {
+
+// Literal is a UTF-8 string literal that is converted to wxString once, the
+// first time it is used, and shared from then on.  Labels in descriptions
+// that are built repeatedly, such as menus rebuilt each time they open, then
+// only copy the converted string:
+//
+//     using namespace wxUI::literals;
+//     wxUI::Item { wxUI_String {}, "&Open..."_wx, "Open a file"_wx, handler };
+//
+// A Literal can be used anywhere a wxString is accepted, which includes the
+// wxUI_String constructors and lists of choices.
+class Literal {
+public:
+    explicit Literal(wxString const& converted)
+        : converted_(&converted)
+    {
+    }
+
+    [[nodiscard]] auto str() const -> wxString const& { return *converted_; }
+
+    // NOLINTNEXTLINE(google-explicit-constructor, hicpp-explicit-conversions)
+    operator wxString const&() const { return *converted_; }
+
+private:
+    wxString const* converted_;
+};
+
+template <details::FixedString Text>
+[[nodiscard]] auto literal() -> Literal
+{
+    static auto const converted = wxString::FromUTF8(Text.data, Text.view().size());
+    return Literal { converted };
+}
+
+inline namespace literals {
+    template <details::FixedString Text>
+    [[nodiscard]] auto operator""_wx() -> Literal
+    {
+        return literal<Text>();
+    }
+}
+
+}
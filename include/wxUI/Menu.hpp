@@ -27,12 +27,14 @@ SOFTWARE.
 #include <memory>
 #include <stdexcept>
 #include <tuple>
+#include <type_traits>
 #include <variant>
 #include <wx/frame.h>
 #include <wx/menu.h>
 #include <wxUI/Customizations.hpp>
 #include <wxUI/Proxy.hpp>
 #include <wxUI/Widget.hpp>
+#include <wxUI/detail/MenuDispatcher.hpp>
 #include <wxUI/wxUITypes.hpp>
 
 namespace wxUI::details {
@@ -56,10 +58,6 @@ concept MenuItem = requires(T widget, wxFrame frame, wxMenu menu, int identity)
 template <typename F, typename Arg>
 concept MenuForEachFunction = MenuItem<typename invoke_apply_result<F, Arg>::type>;
 
-// We provide a way to bind either a function that takes in a commandEvent
-// not to a frame at a specific id
-using function_t = std::variant<std::function<void(wxCommandEvent&)>, std::function<void()>>;
-
 // This is for "type erasure": we support several modes of creating a menu,
 // these are the details on how it is added.
 // We support
@@ -78,20 +76,32 @@ using MenuDetails = std::variant<IDMenuDetails_t, IDMenuDetailsWFunc_t, NamedMen
 
 // If the details are named, we use and increment the identity supplied.
 // The way to add is passed by the caller.  And
+// Handlers go to the menu bar's dispatcher when it has one, otherwise they
+// are bound to the frame.
+template <typename Frame>
+inline void bindMenu(Frame& frame, int identity, function_t const& function)
+{
+    if (auto* dispatcher = MenuDispatcher::current()) {
+        dispatcher->add(identity, function);
+        return;
+    }
+    using ::wxUI::customizations::MenuBindToFrame;
+    MenuBindToFrame(frame, identity, function);
+}
+
 template <typename Frame, typename AppendFunction>
 inline void createAndAdd(Frame& frame, MenuDetails const& item, int& identity, AppendFunction appendFunction)
 {
-    using ::wxUI::customizations::MenuBindToFrame;
     std::visit([&frame, &identity, appendFunction](auto const& item) {
         using T = std::decay_t<decltype(item)>;
         if constexpr (std::is_same_v<T, IDMenuDetails_t>) {
             appendFunction(std::get<0>(item), std::get<1>(item), std::get<2>(item));
         } else if constexpr (std::is_same_v<T, IDMenuDetailsWFunc_t>) {
             appendFunction(std::get<0>(item), std::get<1>(item), std::get<2>(item));
-            MenuBindToFrame(frame, std::get<0>(item), std::get<3>(item));
+            bindMenu(frame, std::get<0>(item), std::get<3>(item));
         } else if constexpr (std::is_same_v<T, NamedMenuDetails_t>) {
             appendFunction(identity, std::get<0>(item), std::get<1>(item));
-            MenuBindToFrame(frame, identity, std::get<2>(item));
+            bindMenu(frame, identity, std::get<2>(item));
             identity += 1;
         } else {
             static_assert(always_false_v<T>, "non-exhaustive visitor!");
@@ -422,26 +432,33 @@ private:
 };
 
 // a submenu constructs menu to give to a menubar
+// Items are forwarded into place, so temporaries (including nested menus)
+// are moved rather than copied at each level.
 template <details::MenuItem... M>
 struct Menu {
-    explicit Menu(std::string_view name, M const&... items)
-        : Menu(name, std::make_tuple(items...))
+    template <typename... UItems>
+    requires(details::MenuItem<std::remove_cvref_t<UItems>> && ...)
+    explicit Menu(std::string_view name, UItems&&... items)
+        : Menu(wxUI_String {}, details::toWxString(name), std::forward<UItems>(items)...)
     {
     }
 
-    Menu(std::string_view name, std::tuple<M...> const& items)
-        : Menu(wxUI_String {}, details::toWxString(name), items)
+    Menu(std::string_view name, std::tuple<M...> items)
+        : Menu(wxUI_String {}, details::toWxString(name), std::move(items))
     {
     }
 
-    Menu(wxUI_String tag, wxString name, M const&... items)
-        : Menu(tag, std::move(name), std::make_tuple(items...))
+    template <typename... UItems>
+    requires(details::MenuItem<std::remove_cvref_t<UItems>> && ...)
+    Menu(wxUI_String, wxString name, UItems&&... items)
+        : name(std::move(name))
+        , items(std::forward<UItems>(items)...)
     {
     }
 
-    Menu(wxUI_String, wxString name, std::tuple<M...> const& items)
+    Menu(wxUI_String, wxString name, std::tuple<M...> items)
         : name(std::move(name))
-        , items(items)
+        , items(std::move(items))
     {
     }
 
@@ -508,15 +525,25 @@ private:
     std::vector<MenuProxy> proxyHandles_;
 };
 
+template <typename... UItems>
+requires(details::MenuItem<std::remove_cvref_t<UItems>> && ...)
+Menu(std::string_view name, UItems&&... items) -> Menu<std::remove_cvref_t<UItems>...>;
+
+template <typename... UItems>
+requires(details::MenuItem<std::remove_cvref_t<UItems>> && ...)
+Menu(wxUI_String, wxString name, UItems&&... items) -> Menu<std::remove_cvref_t<UItems>...>;
+
 template <details::MenuBarItem... M>
 struct MenuBar {
-    explicit MenuBar(M const&... menus)
-        : MenuBar(std::make_tuple(menus...))
+    template <typename... UMenus>
+    requires(details::MenuBarItem<std::remove_cvref_t<UMenus>> && ...)
+    explicit MenuBar(UMenus&&... menus)
+        : menus(std::forward<UMenus>(menus)...)
     {
     }
 
-    explicit MenuBar(std::tuple<M...> const& menus)
-        : menus(menus)
+    explicit MenuBar(std::tuple<M...> menus)
+        : menus(std::move(menus))
     {
     }
 
@@ -532,6 +559,20 @@ struct MenuBar {
         return std::move(*this);
     }
 
+    // Route every item's handler through one wxEVT_MENU handler on the frame
+    // that looks the id up in a table, instead of binding each item.
+    auto withDispatcher() & -> MenuBar&
+    {
+        dispatcher_ = true;
+        return *this;
+    }
+
+    auto withDispatcher() && -> MenuBar&&
+    {
+        dispatcher_ = true;
+        return std::move(*this);
+    }
+
     template <typename Frame>
     auto fitTo(Frame* frame) -> Frame*
     {
@@ -539,10 +580,18 @@ struct MenuBar {
         using ::wxUI::customizations::MenuSetMenuBar;
         auto numbering = int(wxID_AUTO_LOWEST);
         auto menuBar = MenuBarCreate(frame);
-        std::apply([frame, menuBar, &numbering](auto&&... tupleArg) {
-            (tupleArg.createAndAdd(details::ToMenuBarTag {}, *frame, *menuBar, numbering), ...);
-        },
-            menus);
+        auto dispatcher = dispatcher_ ? std::make_shared<details::MenuDispatcher>() : nullptr;
+        {
+            auto scope = details::MenuDispatcher::Scope { dispatcher.get() };
+            std::apply([frame, menuBar, &numbering](auto&&... tupleArg) {
+                (tupleArg.createAndAdd(details::ToMenuBarTag {}, *frame, *menuBar, numbering), ...);
+            },
+                menus);
+        }
+        if (dispatcher) {
+            using ::wxUI::customizations::MenuBindDispatcher;
+            MenuBindDispatcher(*frame, std::shared_ptr<details::MenuDispatcher const> { std::move(dispatcher) });
+        }
         bindProxy(menuBar);
         MenuSetMenuBar(frame, menuBar);
         return frame;
@@ -561,7 +610,12 @@ private:
 
     std::tuple<M...> menus;
     std::vector<MenuBarProxy> proxyHandles_;
+    bool dispatcher_ = false;
 };
+
+template <typename... UMenus>
+requires(details::MenuBarItem<std::remove_cvref_t<UMenus>> && ...)
+MenuBar(UMenus&&... menus) -> MenuBar<std::remove_cvref_t<UMenus>...>;
 }
 
 #include <wxUI/detail/ZapMacros.hpp>
@@ -0,0 +1,153 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+
+#include <wxUI/Customizations.hpp>
+#include <wxUI/detail/Sampler.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <utility>
+
+namespace wxUI::details {
+
+// What a ProgressReporter shares with the sampler.  Workers only store
+// into the atomics; `finished` is set when the last reporter goes away so
+// the sampler can show the final values and forget the control.
+struct ProgressState {
+    ProgressState(int value, int range)
+        : value(value)
+        , range(range)
+    {
+    }
+
+    std::atomic<int> value;
+    std::atomic<int> range;
+    std::atomic<bool> finished { false };
+};
+
+}
+
+namespace wxUI {
+
+// ProgressReporter lets worker threads report progress for a control with
+// a value and a range, such as a Gauge, without going through the event
+// queue:
+//
+//     auto reporter = gaugeProxy.progress();
+//     std::thread { [reporter] {
+//         for (auto i = 0; i <= 100; ++i) {
+//             reporter.setValue(i);
+//         }
+//     } }.detach();
+//
+// Setting a value is a single atomic store, so it can be done at any rate.
+// The UI thread samples all reporters from one shared timer (30 times a
+// second by default) and only updates a control when what it shows has
+// changed.  Once the last copy of a reporter is destroyed, the final values
+// are shown and the control is no longer sampled.  A control destroyed
+// while reporters still exist is no longer sampled either; the reporters
+// can still be written to, but nothing shows it.
+//
+// Reporters are created on the UI thread.
+class ProgressReporter {
+public:
+    void setValue(int value) const noexcept
+    {
+        handle_->state->value.store(value, std::memory_order_relaxed);
+    }
+
+    void setRange(int range) const noexcept
+    {
+        handle_->state->range.store(range, std::memory_order_relaxed);
+    }
+
+    // How often the UI thread samples reporters (and flushes TextLogs).
+    // Takes effect the next time the shared timer starts, which is when one
+    // is created while none are alive.
+    static void setSampleRate(int hertz)
+    {
+        details::Sampler::instance().setInterval(std::chrono::milliseconds { 1000 / std::max(hertz, 1) });
+    }
+
+    // Starts sampling `proxy`, which needs value() and range() accessors.
+    template <typename ProxyType>
+    [[nodiscard]] static auto create(ProxyType const& proxy) -> ProgressReporter
+    {
+        auto shown = std::pair { proxy.value().get(), proxy.range().get() };
+        auto state = std::make_shared<details::ProgressState>(shown.first, shown.second);
+        auto sample = [proxy, state, shown]() mutable {
+            if (proxy.control() == nullptr) {
+                // the control has been destroyed
+                return false;
+            }
+            auto finished = state->finished.load(std::memory_order_acquire);
+            auto latest = std::pair { state->value.load(std::memory_order_relaxed), state->range.load(std::memory_order_relaxed) };
+            if (latest.second != shown.second) {
+                proxy.range() = latest.second;
+            }
+            if (latest.first != shown.first) {
+                proxy.value() = latest.first;
+            }
+            shown = latest;
+            return !finished;
+        };
+        details::Sampler::instance().add(std::move(sample), [proxy] {
+            customizations::SamplerTimerStart(
+                proxy.control(), details::Sampler::instance().interval(),
+                [] { return details::Sampler::instance().tick(); },
+                [] { details::Sampler::instance().timerStopped(); });
+        });
+        return ProgressReporter { std::move(state) };
+    }
+
+private:
+    struct Handle {
+        explicit Handle(std::shared_ptr<details::ProgressState> state)
+            : state(std::move(state))
+        {
+        }
+        ~Handle()
+        {
+            state->finished.store(true, std::memory_order_release);
+        }
+        Handle(Handle const&) = delete;
+        Handle(Handle&&) = delete;
+        auto operator=(Handle const&) -> Handle& = delete;
+        auto operator=(Handle&&) -> Handle& = delete;
+
+        std::shared_ptr<details::ProgressState> state;
+    };
+
+    explicit ProgressReporter(std::shared_ptr<details::ProgressState> state)
+        : handle_(std::make_shared<Handle>(std::move(state)))
+    {
+    }
+
+    std::shared_ptr<Handle> handle_;
+};
+
+}
@@ -0,0 +1,129 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+#include <wxUI/Layout.hpp>
+#include <wxUI/detail/PrototypeScope.hpp>
+
+namespace wxUI {
+
+// Prototype creates the same description many times over, such as one channel
+// strip for each input of a mixing console.  The description, with its strings
+// converted and its sizer flags worked out, is kept once and shared by every
+// copy stamped out of it, and the fonts of its controllers are only made once.
+// Each copy can have proxies of its own: withProxy on a stamp names a proxy in
+// the description and the proxy to attach in its place.
+//
+//     auto gain = wxUI::Slider::Proxy {};
+//     auto strip = wxUI::Prototype { wxUI::VSizer { wxUI::Slider {}.withProxy(gain), ... } };
+//     for (auto& channel : channels) {
+//         console.add(strip.stamp().withProxy(gain, channel.gain));
+//     }
+//
+// withBestSizesReused measures the controllers of the first copy and gives
+// every later copy the same sizes as their minimum, so that only the first
+// copy has to be measured by its sizers.  Only use it when all the copies have
+// the same labels, fonts and DPI scale.
+template <details::SizerItem Layout>
+class Prototype {
+    struct State {
+        Layout layout;
+        details::PrototypeCache cache {};
+    };
+
+public:
+    // One copy of the prototype, to be put wherever the description could.
+    class Stamp {
+    public:
+        explicit Stamp(std::shared_ptr<State> state)
+            : state_(std::move(state))
+        {
+        }
+
+        template <typename Underlying>
+        auto withProxy(details::Proxy<Underlying> const& prototypeProxy, details::Proxy<Underlying> const& proxy) & -> Stamp&
+        {
+            redirects_.push_back({ prototypeProxy.identity(), proxy });
+            return *this;
+        }
+
+        template <typename Underlying>
+        auto withProxy(details::Proxy<Underlying> const& prototypeProxy, details::Proxy<Underlying> const& proxy) && -> Stamp&&
+        {
+            redirects_.push_back({ prototypeProxy.identity(), proxy });
+            return std::move(*this);
+        }
+
+        template <typename Parent, typename Sizer>
+        void createAndAdd(Parent* parent, Sizer* sizer, wxSizerFlags const& parentFlags)
+        {
+            auto scope = details::PrototypeScope { state_->cache, redirects_ };
+            state_->layout.createAndAdd(parent, sizer, parentFlags);
+            scope.finish();
+        }
+
+        template <typename Parent>
+        auto fitTo(Parent* parent) -> Parent*
+        {
+            auto scope = details::PrototypeScope { state_->cache, redirects_ };
+            state_->layout.fitTo(parent);
+            scope.finish();
+            return parent;
+        }
+
+    private:
+        std::shared_ptr<State> state_;
+        std::vector<details::ProxyRedirect> redirects_ {};
+    };
+
+    explicit Prototype(Layout layout)
+        : state_(std::make_shared<State>(std::move(layout)))
+    {
+    }
+
+    auto withBestSizesReused() & -> Prototype&
+    {
+        state_->cache.reuseBestSizes = true;
+        return *this;
+    }
+
+    auto withBestSizesReused() && -> Prototype&&
+    {
+        state_->cache.reuseBestSizes = true;
+        return std::move(*this);
+    }
+
+    [[nodiscard]] auto stamp() const -> Stamp
+    {
+        return Stamp { state_ };
+    }
+
+private:
+    std::shared_ptr<State> state_;
+};
+
+}
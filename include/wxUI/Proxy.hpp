@@ -23,15 +23,33 @@ SOFTWARE.
 */
 #pragma once
 
+#include <wxUI/Customizations.hpp>
+#include <wxUI/GetterSetter.hpp>
+#include <wxUI/detail/PostQueue.hpp>
+
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <stdexcept>
+#include <utility>
+
+namespace wxUI {
+template <typename ProxyType>
+class Posted;
+
+template <typename ProxyType>
+auto post(ProxyType const& proxy) -> Posted<ProxyType>;
+
+template <typename ProxyType>
+auto postLatest(ProxyType const& proxy) -> Posted<ProxyType>;
+}
 
 namespace wxUI::details {
 
 template <typename Underlying>
 struct Proxy {
     Proxy()
-        : controller_(std::make_shared<Underlying*>())
+        : controller_(std::make_shared<std::atomic<Underlying*>>())
     {
     }
 
@@ -40,20 +58,139 @@ struct Proxy {
         if (!controller_) {
             throw std::runtime_error("Proxy class has not been attached");
         }
-        return *controller_;
+        return controller_->load(std::memory_order_acquire);
     }
 
     void setUnderlying(Underlying* control)
     {
-        *controller_ = control;
+        controller_->store(control, std::memory_order_release);
     }
 
     auto operator->() const { return control(); }
 
     explicit operator bool() const noexcept { return controller_ != nullptr; }
 
+    // Copies of a proxy are attached together; this is the same for all of
+    // them and different for every other proxy.
+    [[nodiscard]] auto identity() const noexcept -> void const* { return controller_.get(); }
+
+#if defined(__cpp_explicit_this_parameter)
+    // proxy.post().value() = x; see wxUI::post.
+    template <typename Self>
+    [[nodiscard]] auto post(this Self const& self) { return wxUI::post(self); }
+
+    template <typename Self>
+    [[nodiscard]] auto postLatest(this Self const& self) { return wxUI::postLatest(self); }
+#endif
+
+protected:
+    // Shared by all copies; set to nullptr when the control is destroyed.
+    // Atomic because workers read it through wxUI::post while the UI thread
+    // may be clearing it.
+    [[nodiscard]] auto attachment() const -> std::shared_ptr<std::atomic<Underlying*>> const& { return controller_; }
+
 private:
-    std::shared_ptr<Underlying*> controller_ {};
+    std::shared_ptr<std::atomic<Underlying*>> controller_ {};
 };
 
 }
+
+namespace wxUI {
+
+// Posted is a Proxy whose accessor writes are sent to the UI thread rather
+// than applied on the calling thread, so they are safe to make from a worker:
+//
+//     wxUI::post(gaugeProxy).value() = 42;
+//
+// The writes go onto a lock-free queue that the UI thread drains in one go,
+// in the order they were made.  With postLatest, a write replaces any write
+// through the same accessor of the same control that has not been applied
+// yet, so a fast producer costs at most one update per drain.  Writes for a
+// control that is destroyed before they are posted or applied are dropped.
+//
+// Only writes through accessors of the proxy's control are posted, and only
+// while the Posted object exists, which for the expression above is until
+// the end of the statement.  A Transaction open on the same thread keeps the
+// writes to its window.  Reads are not thread-safe, and the proxy must
+// already be attached.
+template <typename ProxyType>
+class Posted : public ProxyType {
+public:
+    Posted(ProxyType const& proxy, bool latest)
+        : ProxyType(proxy)
+        , sink_(proxy.control(), this->attachment(), latest)
+    {
+        sink_.outer = std::exchange(details::currentPost(), &sink_);
+    }
+
+    ~Posted()
+    {
+        for (auto** link = &details::currentPost(); *link != nullptr; link = &(*link)->outer) {
+            if (*link == &sink_) {
+                *link = sink_.outer;
+                break;
+            }
+        }
+    }
+
+    Posted(Posted const&) = delete;
+    Posted(Posted&&) = delete;
+    auto operator=(Posted const&) -> Posted& = delete;
+    auto operator=(Posted&&) -> Posted& = delete;
+
+private:
+    using Underlying = std::remove_pointer_t<decltype(std::declval<ProxyType const&>().control())>;
+
+    using Attachment = std::atomic<Underlying*>;
+
+    struct Sink : details::PostSink {
+        Sink(Underlying* control, std::shared_ptr<Attachment> attachment, bool latest)
+            : PostSink(control)
+            , typedControl(control)
+            , attachment(std::move(attachment))
+            , latest(latest)
+        {
+        }
+        void defer(details::WriteTarget const&, void const* accessor, std::function<void()> write) override
+        {
+            // The control was already gone when the write was made.
+            if (control == nullptr) {
+                return;
+            }
+            auto& queue = details::PostQueue::instance();
+            auto alive = details::PostQueue::Alive { attachment, [](void const* attachment, void const* control) {
+                                                        return control != nullptr && static_cast<Attachment const*>(attachment)->load(std::memory_order_acquire) == control;
+                                                    } };
+            if (queue.push(control, accessor, latest, std::move(write), std::move(alive))) {
+                wake(typedControl);
+            }
+        }
+        static void wake(Underlying* control)
+        {
+            customizations::ProxyPostWake(control, [control] {
+                if (details::PostQueue::instance().drain()) {
+                    wake(control);
+                }
+            });
+        }
+        Underlying* typedControl;
+        std::shared_ptr<Attachment> attachment;
+        bool latest;
+    };
+
+    Sink sink_;
+};
+
+template <typename ProxyType>
+auto post(ProxyType const& proxy) -> Posted<ProxyType>
+{
+    return { proxy, false };
+}
+
+template <typename ProxyType>
+auto postLatest(ProxyType const& proxy) -> Posted<ProxyType>
+{
+    return { proxy, true };
+}
+
+}
@@ -25,6 +25,7 @@ SOFTWARE.
 
 #include <iostream>
 #include <wx/radiobox.h>
+#include <wxUI/ChoiceList.hpp>
 #include <wxUI/GetterSetter.hpp>
 #include <wxUI/Widget.hpp>
 
@@ -184,7 +185,7 @@ struct RadioBox {
     RadioBox(wxWindowID identity, wxUI_String, wxString text, withChoices, details::Ranges::utf8_text_input_range auto&& choices)
         : details_(identity)
         , text_(std::move(text))
-        , choices_(details::Ranges::ToVectorUtf8(std::forward<decltype(choices)>(choices)))
+        , choices_(details::toChoiceList(std::forward<decltype(choices)>(choices)))
     {
         details_.setStyle(wxRA_SPECIFY_COLS);
     }
@@ -242,6 +243,7 @@ struct RadioBox {
         {
             auto* controller = control();
             return details::GetterSetter {
+                controller,
                 [controller] { return controller->GetSelection(); },
                 [controller](int selection) { controller->SetSelection(selection); }
             };
@@ -253,7 +255,7 @@ struct RadioBox {
 private:
     details::WidgetDetails<RadioBox, wxRadioBox> details_;
     wxString text_;
-    std::vector<wxString> choices_;
+    ChoiceList choices_;
     int majorDim_ {};
     int selection_ {};
 
@@ -82,6 +82,7 @@ struct Slider {
         {
             auto* controller = control();
             return details::GetterSetter {
+                controller,
                 [controller] { return controller->GetValue(); },
                 [controller](int value) { controller->SetValue(value); }
             };
@@ -82,6 +82,7 @@ struct SpinCtrl {
         {
             auto* controller = control();
             return details::GetterSetter {
+                controller,
                 [controller] { return controller->GetValue(); },
                 [controller](int value) { controller->SetValue(value); }
             };
@@ -26,6 +26,7 @@ SOFTWARE.
 #include <wx/stattext.h>
 #include <wx/string.h>
 #include <wxUI/GetterSetter.hpp>
+#include <wxUI/TextExtentCache.hpp>
 #include <wxUI/Widget.hpp>
 
 #include <wxUI/detail/HelperMacros.hpp>
@@ -74,6 +75,7 @@ struct Text {
         {
             auto* controller = control();
             return details::GetterSetter {
+                controller,
                 [controller] { return controller->GetLabel().utf8_string(); },
                 [controller](std::string const& label) { controller->SetLabel(wxString::FromUTF8(label)); }
             };
@@ -92,11 +94,16 @@ private:
     auto createImpl()
     {
         return [&text = text_, &wrap = wrap_](Parent* parent, wxWindowID id, wxPoint pos, wxSize size, int64_t style) {
-            auto* widget = customizations::ParentCreate<underlying_t>(parent, id, text, pos, size, style);
-            if (wrap) {
-                widget->Wrap(*wrap);
-            }
-            return widget;
+            return TextExtentCache::instance().create<underlying_t>(
+                parent, text, size, style, wrap,
+                [&](wxString const& label, wxSize labelSize) {
+                    return customizations::ParentCreate<underlying_t>(parent, id, label, pos, labelSize, style);
+                },
+                [&](auto* widget) {
+                    if (wrap) {
+                        widget->Wrap(*wrap);
+                    }
+                });
         };
     }
 
@@ -26,10 +26,61 @@ SOFTWARE.
 #include <wx/string.h>
 #include <wx/textctrl.h>
 #include <wxUI/GetterSetter.hpp>
+#include <wxUI/TextLog.hpp>
 #include <wxUI/Widget.hpp>
 
 #include <wxUI/detail/HelperMacros.hpp>
 
+namespace wxUI::details {
+
+// The accessors of TextCtrl::Proxy.  They only use the interface of
+// wxTextCtrl, so they work for any control that provides it.
+template <typename Underlying>
+struct TextCtrlProxy : Proxy<Underlying> {
+    [[nodiscard]] auto label() const
+    {
+        auto* controller = this->control();
+        return GetterSetter {
+            controller,
+            [controller] { return controller->GetValue().utf8_string(); },
+            [controller](std::string const& label) { controller->SetValue(wxString::FromUTF8(label)); }
+        };
+    }
+
+    // Incremental access that only converts the text it touches, rather
+    // than the whole contents as label() does.  Positions and line
+    // numbers are as wxTextCtrl counts them.
+    [[nodiscard]] auto length() const -> long { return this->control()->GetLastPosition(); }
+    [[nodiscard]] auto lineCount() const -> int { return this->control()->GetNumberOfLines(); }
+    [[nodiscard]] auto range(long from, long to) const -> std::string { return this->control()->GetRange(from, to).utf8_string(); }
+    [[nodiscard]] auto line(long lineNumber) const -> std::string { return this->control()->GetLineText(lineNumber).utf8_string(); }
+
+    void insert(long position, std::string_view text) const { replace(position, position, text); }
+
+    void replace(long from, long to, std::string_view text) const
+    {
+        auto* controller = this->control();
+        applyOrQueueEdit(writeTarget(controller), [controller, from, to, text = wxString::FromUTF8(text.data(), text.size())] {
+            controller->Replace(from, to, text);
+        });
+    }
+
+    void append(std::string_view text) const
+    {
+        auto* controller = this->control();
+        applyOrQueueEdit(writeTarget(controller), [controller, text = wxString::FromUTF8(text.data(), text.size())] {
+            controller->AppendText(text);
+        });
+    }
+
+    // For feeding the control as a bounded log; see TextLog.
+    [[nodiscard]] auto log(TextLog::Limits limits = {}) const { return TextLog::create(*this, limits); }
+
+    auto operator*() const { return label(); }
+};
+
+}
+
 namespace wxUI {
 
 // https://docs.wxwidgets.org/latest/classwx_text_ctrl.html
@@ -71,18 +122,7 @@ struct TextCtrl {
         return std::move(*this);
     }
 
-    struct Proxy : details::Proxy<underlying_t> {
-        [[nodiscard]] auto label() const
-        {
-            auto* controller = control();
-            return details::GetterSetter {
-                [controller] { return controller->GetValue().utf8_string(); },
-                [controller](std::string const& label) { controller->SetValue(wxString::FromUTF8(label)); }
-            };
-        }
-
-        auto operator*() const { return label(); }
-    };
+    struct Proxy : details::TextCtrlProxy<underlying_t> { };
 
 private:
     details::WidgetDetails<TextCtrl, wxTextCtrl> details_;
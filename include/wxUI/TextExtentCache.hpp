@@ -0,0 +1,117 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <tuple>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+#include <wx/string.h>
+#include <wxUI/Customizations.hpp>
+
+namespace wxUI {
+
+// TextExtentCache remembers how wxWidgets measured the labels of the Text and
+// Button controllers wxUI makes: the label once wrapped, and the best size.
+// Another controller of the same type, style and wrap width, showing the same
+// label in the same font at the same DPI scale, is then made at that size
+// straight away instead of being measured again, which for forms with
+// thousands of labels saves much of the time spent in the platform's text
+// layout.
+//
+// The font and DPI scale are part of what a label is remembered by, so after
+// either changes the remembered sizes are no longer used.  The cache is shared
+// by the whole process, is only used from the UI thread, and forgets
+// everything once it holds kMaxEntries labels.  clear() forgets everything
+// now, for instance after the system font changes.
+class TextExtentCache {
+public:
+    static constexpr std::size_t kMaxEntries = 4096;
+
+    static auto instance() -> TextExtentCache&
+    {
+        static auto cache = TextExtentCache {};
+        return cache;
+    }
+
+    void clear() { extents_.clear(); }
+    [[nodiscard]] auto size() const { return extents_.size(); }
+
+    // Makes a label controller of type `Underlying` through `construct`,
+    // called with a label and a size; `measure` does whatever else changes
+    // the label once it is made, such as wrapping it.  Controllers given a
+    // size of their own are made as they always were.
+    template <typename Underlying, typename Parent, typename Construct, typename Measure>
+    auto create(Parent* parent, wxString const& text, wxSize size, int64_t style, std::optional<int> wrap, Construct&& construct, Measure&& measure)
+    {
+        auto context = size == wxDefaultSize ? customizations::ParentTextExtentContext(parent) : std::nullopt;
+        if (!context) {
+            auto* widget = construct(text, size);
+            measure(widget);
+            return widget;
+        }
+
+        auto key = Key { typeid(Underlying), style, wrap.value_or(-1), context->scale, context->fontDescription, text };
+        if (auto found = extents_.find(key); found != extents_.end()) {
+            auto* widget = construct(found->second.label, found->second.bestSize);
+            if (!customizations::ControllerUseTextExtent(widget, *context, found->second, text)) {
+                measure(widget);
+            }
+            return widget;
+        }
+
+        auto* widget = construct(text, size);
+        measure(widget);
+        if (auto extent = customizations::ControllerTextExtent(widget, *context)) {
+            if (extents_.size() >= kMaxEntries) {
+                extents_.clear();
+            }
+            extents_.emplace(std::move(key), std::move(*extent));
+        }
+        return widget;
+    }
+
+private:
+    struct Key {
+        std::type_index type;
+        int64_t style {};
+        int wrap {};
+        double scale {};
+        wxString font;
+        wxString text;
+
+        auto operator<(Key const& other) const -> bool
+        {
+            return std::tie(type, style, wrap, scale, font, text) < std::tie(other.type, other.style, other.wrap, other.scale, other.font, other.text);
+        }
+    };
+
+    std::map<Key, customizations::TextExtent> extents_ {};
+};
+
+}
@@ -0,0 +1,302 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+
+#include <wx/string.h>
+#include <wxUI/Customizations.hpp>
+#include <wxUI/detail/Sampler.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace wxUI::details {
+
+// Erases whole lines of `text`, from `from` (the start of a line), that
+// would be trimmed anyway to keep to the last `maxLines` lines and
+// `maxBytes` bytes.
+inline void trimOldLines(std::string& text, std::string::size_type from, std::size_t maxLines, std::size_t maxBytes)
+{
+    auto cut = std::string::size_type {};
+    if (maxLines > 0 && text.size() > 1) {
+        auto lines = std::size_t {};
+        for (auto i = text.size() - 1; i-- > 0;) {
+            if (text[i] == '\n' && ++lines == maxLines) {
+                cut = i + 1;
+                break;
+            }
+        }
+    }
+    if (maxBytes > 0 && text.size() - cut > maxBytes) {
+        auto newline = text.find('\n', text.size() - maxBytes - 1);
+        if (newline != std::string::npos && newline + 1 < text.size()) {
+            cut = newline + 1;
+        }
+    }
+    if (cut > from) {
+        text.erase(from, cut - from);
+    }
+}
+
+// What a TextLog shares with the sampler: text appended since the last
+// flush.  `finished` is set when the last TextLog goes away.
+struct TextLogState {
+    TextLogState(std::size_t maxLines, std::size_t maxBytes)
+        : maxLines(maxLines)
+        , maxBytes(maxBytes)
+    {
+    }
+
+    // With `mutex` held.  Once `pending` holds twice what the control may
+    // show, the oldest lines are dropped, so a log that is fed faster than
+    // the UI samples it stays bounded.  The first line is kept as it may
+    // finish a line already in the control.
+    void append(std::string_view text)
+    {
+        pending.append(text);
+        pendingLines += static_cast<std::size_t>(std::ranges::count(text, '\n'));
+        if ((maxLines > 0 && pendingLines > 2 * maxLines) || (maxBytes > 0 && pending.size() > 2 * maxBytes)) {
+            if (auto first = pending.find('\n'); first != std::string::npos) {
+                trimOldLines(pending, first + 1, maxLines, maxBytes);
+                pendingLines = static_cast<std::size_t>(std::ranges::count(pending, '\n'));
+            }
+        }
+    }
+
+    // With `mutex` held.
+    auto take() -> std::string
+    {
+        pendingLines = 0;
+        return std::exchange(pending, {});
+    }
+
+    std::mutex mutex;
+    std::string pending;
+    std::size_t maxLines;
+    std::size_t maxBytes;
+    std::size_t pendingLines {};
+    std::atomic<bool> finished { false };
+};
+
+// The UI side of a TextLog.  Keeps the length of every line in the control
+// so the oldest ones can be trimmed without asking the control for its
+// contents.
+class TextLogLines {
+public:
+    TextLogLines(std::size_t maxLines, std::size_t maxBytes)
+        : maxLines_(maxLines)
+        , maxBytes_(maxBytes)
+    {
+    }
+
+    // Cuts whole lines from the front of `text` that would be trimmed
+    // anyway, so they are never converted or sent to the control.  If the
+    // control ends in a partial line, the text that finishes it is kept so
+    // that it is not joined to a later line.
+    void preTrim(std::string& text) const
+    {
+        auto from = std::string::size_type {};
+        if (partial_) {
+            from = text.find('\n');
+            if (from == std::string::npos) {
+                return;
+            }
+            ++from;
+        }
+        trimOldLines(text, from, maxLines_, maxBytes_);
+    }
+
+    // Records `text` (`utf8` as the control sees it) as appended, then
+    // trims the oldest lines to stay within the caps.  Returns how many
+    // lines to remove from the front of the control, and how many
+    // characters of the front of `text` to leave out.  Lines rather than
+    // positions go to the control, as some count a newline as two.
+    auto append(std::string_view utf8, wxString const& text) -> std::pair<long, long>
+    {
+        auto linesInControl = static_cast<long>(lines_.size());
+        auto byteStart = std::size_t {};
+        auto charStart = std::size_t {};
+        while (byteStart < utf8.size()) {
+            auto byteEnd = utf8.find('\n', byteStart);
+            auto charEnd = text.find('\n', charStart);
+            auto complete = byteEnd != std::string_view::npos && charEnd != wxString::npos;
+            byteEnd = complete ? byteEnd + 1 : utf8.size();
+            charEnd = complete ? charEnd + 1 : text.length();
+            auto line = Line { static_cast<long>(charEnd - charStart), byteEnd - byteStart };
+            if (partial_) {
+                lines_.back().positions += line.positions;
+                lines_.back().bytes += line.bytes;
+            } else {
+                lines_.push_back(line);
+            }
+            partial_ = !complete;
+            bytes_ += line.bytes;
+            byteStart = byteEnd;
+            charStart = charEnd;
+        }
+
+        auto inControl = positions_;
+        positions_ += static_cast<long>(text.length());
+        auto trimmed = 0L;
+        auto trimmedLines = 0L;
+        while (lines_.size() > 1 && ((maxLines_ > 0 && lines_.size() > maxLines_) || (maxBytes_ > 0 && bytes_ > maxBytes_))) {
+            trimmed += lines_.front().positions;
+            ++trimmedLines;
+            bytes_ -= lines_.front().bytes;
+            lines_.pop_front();
+        }
+        positions_ -= trimmed;
+        return { std::min(trimmedLines, linesInControl), trimmed - std::min(trimmed, inControl) };
+    }
+
+private:
+    struct Line {
+        long positions;
+        std::size_t bytes;
+    };
+
+    std::size_t maxLines_;
+    std::size_t maxBytes_;
+    std::deque<Line> lines_;
+    bool partial_ {};
+    long positions_ {};
+    std::size_t bytes_ {};
+};
+
+}
+
+namespace wxUI {
+
+// TextLog turns a multi-line TextCtrl into a bounded log that can be fed at
+// a high rate, from any thread:
+//
+//     auto log = textCtrlProxy.log({ .maxLines = 5'000 });
+//     log.appendLine("connected");
+//
+// Appends only add to a buffer.  On each tick of the shared sampling timer
+// (see ProgressReporter::setSampleRate) the buffer is converted once and
+// added with a single AppendText, and the oldest lines are removed so the
+// control stays within `maxLines` lines and `maxBytes` bytes of UTF-8 (zero
+// means no limit).  The view follows the new text only if it was already
+// scrolled to the end, so a user reading back through the log is not
+// disturbed.  Text waiting for the next tick is bounded by the same limits.
+//
+// The log assumes it is the only thing changing the control.  Logs are
+// created on the UI thread; once the control is destroyed, what is appended
+// is discarded.
+class TextLog {
+public:
+    struct Limits {
+        std::size_t maxLines = 10'000;
+        std::size_t maxBytes = 0;
+    };
+
+    void append(std::string_view text) const
+    {
+        auto& state = *handle_->state;
+        auto lock = std::scoped_lock { state.mutex };
+        state.append(text);
+    }
+
+    void appendLine(std::string_view line) const
+    {
+        auto& state = *handle_->state;
+        auto lock = std::scoped_lock { state.mutex };
+        state.append(line);
+        state.append("\n");
+    }
+
+    // Starts logging to `proxy`, which needs a label() accessor.
+    template <typename ProxyType>
+    [[nodiscard]] static auto create(ProxyType const& proxy, Limits limits) -> TextLog
+    {
+        auto state = std::make_shared<details::TextLogState>(limits.maxLines, limits.maxBytes);
+        auto lines = details::TextLogLines { limits.maxLines, limits.maxBytes };
+        auto initial = proxy.label().get();
+        lines.append(initial, wxString::FromUTF8(initial));
+
+        auto sample = [proxy, state, lines = std::move(lines)]() mutable {
+            if (proxy.control() == nullptr) {
+                // the control has been destroyed
+                return false;
+            }
+            auto finished = state->finished.load(std::memory_order_acquire);
+            auto text = std::string {};
+            {
+                auto lock = std::scoped_lock { state->mutex };
+                text = state->take();
+            }
+            if (!text.empty()) {
+                lines.preTrim(text);
+                auto converted = wxString::FromUTF8(text);
+                auto [removeLines, skip] = lines.append(text, converted);
+                if (skip > 0) {
+                    converted.Remove(0, static_cast<std::size_t>(skip));
+                }
+                customizations::TextLogUpdate(proxy.control(), removeLines, converted);
+            }
+            return !finished;
+        };
+        details::Sampler::instance().add(std::move(sample), [proxy] {
+            customizations::SamplerTimerStart(
+                proxy.control(), details::Sampler::instance().interval(),
+                [] { return details::Sampler::instance().tick(); },
+                [] { details::Sampler::instance().timerStopped(); });
+        });
+        return TextLog { std::move(state) };
+    }
+
+private:
+    struct Handle {
+        explicit Handle(std::shared_ptr<details::TextLogState> state)
+            : state(std::move(state))
+        {
+        }
+        ~Handle()
+        {
+            state->finished.store(true, std::memory_order_release);
+        }
+        Handle(Handle const&) = delete;
+        Handle(Handle&&) = delete;
+        auto operator=(Handle const&) -> Handle& = delete;
+        auto operator=(Handle&&) -> Handle& = delete;
+
+        std::shared_ptr<details::TextLogState> state;
+    };
+
+    explicit TextLog(std::shared_ptr<details::TextLogState> state)
+        : handle_(std::make_shared<Handle>(std::move(state)))
+    {
+    }
+
+    std::shared_ptr<Handle> handle_;
+};
+
+}
@@ -0,0 +1,138 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+
+#include <wxUI/Customizations.hpp>
+#include <wxUI/GetterSetter.hpp>
+#include <wxUI/Layout.hpp>
+
+#include <exception>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace wxUI {
+
+// A Transaction batches the writes made through Proxy accessors, such as
+// `textProxy.label() = "..."`, to controls in `window` while it is in scope.
+// The writes are queued and, when the Transaction ends, applied in order
+// with `window` frozen, followed by a single Layout and Refresh.  Writes to
+// controls in other windows are applied straight away.
+//
+// Reads made inside the Transaction see the controls as they were before
+// it started, but compound assignments such as `proxy.value() += 1` build
+// on the writes already queued.  Only writes through accessors are queued;
+// calls made directly on the underlying control (`proxy->SetLabel(...)`)
+// are not.  A Transaction opened inside another one takes the writes for
+// its own window, and freezes and lays out only that.  If the scope is left
+// by an exception, the queued writes are discarded.
+//
+// A write that throws while the writes are applied ends the Transaction and
+// drops the writes after it.  commit() passes the exception on; from the
+// destructor it would terminate the program, so call commit() explicitly
+// when writes can throw.
+template <typename Window = wxWindow>
+class Transaction {
+public:
+    explicit Transaction(Window* window)
+        : window_(window)
+        , writes_(window)
+        , uncaughtExceptions_(std::uncaught_exceptions())
+    {
+        writes_.outer = std::exchange(details::currentTransaction(), &writes_);
+        open_ = true;
+    }
+
+    explicit Transaction(SizerProxy const& sizer)
+    requires std::same_as<Window, wxWindow>
+        : Transaction(sizer->GetContainingWindow())
+    {
+    }
+
+    ~Transaction()
+    {
+        if (std::uncaught_exceptions() > uncaughtExceptions_) {
+            writes_.writes.clear();
+        }
+        commit();
+    }
+
+    Transaction(Transaction const&) = delete;
+    Transaction(Transaction&&) = delete;
+    auto operator=(Transaction const&) -> Transaction& = delete;
+    auto operator=(Transaction&&) -> Transaction& = delete;
+
+    // Applies the writes queued so far and ends the Transaction; later
+    // writes are applied immediately.
+    void commit()
+    {
+        if (!open_) {
+            return;
+        }
+        close();
+        auto writes = std::exchange(writes_.writes, {});
+        writes_.pendingValues.clear();
+        if (writes.empty()) {
+            return;
+        }
+        customizations::WindowUpdate(window_, [&writes] {
+            for (auto& write : writes) {
+                write();
+            }
+        });
+    }
+
+private:
+    struct Writes : details::TransactionSink {
+        using TransactionSink::TransactionSink;
+        void defer(details::WriteTarget const&, void const*, std::function<void()> write) override
+        {
+            writes.push_back(std::move(write));
+        }
+        std::vector<std::function<void()>> writes;
+    };
+
+    // Takes this Transaction out of the list of open ones, wherever it is.
+    void close()
+    {
+        open_ = false;
+        for (auto** link = &details::currentTransaction(); *link != nullptr; link = &(*link)->outer) {
+            if (*link == &writes_) {
+                *link = writes_.outer;
+                return;
+            }
+        }
+    }
+
+    Window* window_;
+    Writes writes_;
+    int uncaughtExceptions_;
+    bool open_ {};
+};
+
+Transaction(SizerProxy const&) -> Transaction<wxWindow>;
+
+}
+
+#include <wxUI/detail/ZapMacros.hpp>
@@ -0,0 +1,301 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <ranges>
+#include <wx/dc.h>
+#include <wx/settings.h>
+#include <wx/vlbox.h>
+#include <wxUI/GetterSetter.hpp>
+#include <wxUI/Widget.hpp>
+
+#include <wxUI/detail/HelperMacros.hpp>
+
+namespace wxUI {
+
+namespace details {
+
+    // A generator produces the text of a row from its index.
+    template <typename Function>
+    concept virtual_list_generator = std::invocable<Function const&, size_t>
+        && utf8_text_choice<std::invoke_result_t<Function const&, size_t>>;
+
+    template <typename Range>
+    concept virtual_list_range = std::ranges::random_access_range<Range>
+        && std::ranges::sized_range<Range>
+        && utf8_text_choice<std::ranges::range_reference_t<Range>>;
+
+    // wxVListBox that asks for the text of a row only when that row is drawn,
+    // so the cost of a list does not depend on how many rows it has.
+    class VirtualListBoxCtrl : public wxVListBox {
+    public:
+        using Generator = std::function<wxString(size_t)>;
+
+        VirtualListBoxCtrl(wxWindow* parent, wxWindowID id, wxPoint const& pos, wxSize const& size, long style, size_t count, Generator generator)
+            : wxVListBox(parent, id, pos, size, style)
+            , generator_(std::move(generator))
+        {
+            SetItemCount(count);
+        }
+
+        [[nodiscard]] auto GetString(size_t item) const -> wxString
+        {
+            return generator_(item);
+        }
+
+    protected:
+        void OnDrawItem(wxDC& dc, wxRect const& rect, size_t item) const override
+        {
+            dc.SetFont(GetFont());
+            dc.SetTextForeground(IsSelected(item) ? wxSystemSettings::GetColour(wxSYS_COLOUR_HIGHLIGHTTEXT) : GetForegroundColour());
+            dc.DrawText(generator_(item), rect.x + kMargin, rect.y + kMargin);
+        }
+
+        auto OnMeasureItem([[maybe_unused]] size_t item) const -> wxCoord override
+        {
+            return GetCharHeight() + (2 * kMargin);
+        }
+
+    private:
+        static constexpr auto kMargin = 2;
+        Generator generator_;
+    };
+
+    template <virtual_list_generator Function>
+    inline auto makeVirtualListGenerator(Function&& function) -> VirtualListBoxCtrl::Generator
+    {
+        return [function = std::forward<Function>(function)](size_t item) {
+            return toWxString(function(item));
+        };
+    }
+
+    // The list may hold on to the range for as long as the control lives, so
+    // an rvalue range is moved into shared storage; an lvalue range is
+    // referenced and must outlive the control.
+    template <virtual_list_range Range>
+    inline auto makeVirtualListGenerator(Range&& range) -> VirtualListBoxCtrl::Generator
+    {
+        auto view = std::make_shared<std::views::all_t<Range>>(std::views::all(std::forward<Range>(range)));
+        return [view](size_t item) {
+            return toWxString((*view)[static_cast<std::ranges::range_difference_t<Range>>(item)]);
+        };
+    }
+
+}
+
+// Rows are produced on demand from a range or an `(index) -> string`
+// function instead of being copied into the control.
+// https://docs.wxwidgets.org/latest/classwx_v_list_box.html
+struct VirtualListBox {
+    using underlying_t = details::VirtualListBoxCtrl;
+
+    template <details::virtual_list_generator Function>
+    VirtualListBox(size_t count, Function&& generator)
+        : VirtualListBox(wxID_ANY, count, std::forward<Function>(generator))
+    {
+    }
+
+    template <details::virtual_list_range Range>
+    explicit VirtualListBox(Range&& range)
+        : VirtualListBox(wxID_ANY, std::forward<Range>(range))
+    {
+    }
+
+    template <details::virtual_list_generator Function>
+    VirtualListBox(wxWindowID identity, size_t count, Function&& generator)
+        : details_(identity)
+        , count_(count)
+        , generator_(details::makeVirtualListGenerator(std::forward<Function>(generator)))
+    {
+    }
+
+    template <details::virtual_list_range Range>
+    VirtualListBox(wxWindowID identity, Range&& range)
+        : details_(identity)
+        , count_(std::ranges::size(range))
+        , generator_(details::makeVirtualListGenerator(std::forward<Range>(range)))
+    {
+    }
+
+    auto setSelection(int which) & -> VirtualListBox&
+    {
+        selection_ = { which };
+        return *this;
+    }
+
+    auto setSelection(int which) && -> VirtualListBox&&
+    {
+        selection_ = { which };
+        return std::move(*this);
+    }
+
+    auto withSelection(int which) & -> VirtualListBox&
+    {
+        selection_.push_back(which);
+        return *this;
+    }
+
+    auto withSelection(int which) && -> VirtualListBox&&
+    {
+        selection_.push_back(which);
+        return std::move(*this);
+    }
+
+    auto withSelections(std::vector<int> which) & -> VirtualListBox&
+    {
+        selection_.insert(selection_.end(), which.begin(), which.end());
+        return *this;
+    }
+
+    auto withSelections(std::vector<int> which) && -> VirtualListBox&&
+    {
+        selection_.insert(selection_.end(), which.begin(), which.end());
+        return std::move(*this);
+    }
+
+    template <typename Function>
+    auto bind(Function func) & -> VirtualListBox&
+    {
+        details_.bind(wxEVT_LISTBOX, func);
+        return *this;
+    }
+
+    template <typename Function>
+    auto bind(Function func) && -> VirtualListBox&&
+    {
+        details_.bind(wxEVT_LISTBOX, func);
+        return std::move(*this);
+    }
+
+    template <typename Function>
+    auto bindDClick(Function func) & -> VirtualListBox&
+    {
+        details_.bind(wxEVT_LISTBOX_DCLICK, func);
+        return *this;
+    }
+
+    template <typename Function>
+    auto bindDClick(Function func) && -> VirtualListBox&&
+    {
+        details_.bind(wxEVT_LISTBOX_DCLICK, func);
+        return std::move(*this);
+    }
+
+    struct Proxy : details::Proxy<underlying_t> {
+        [[nodiscard]] auto selection() const
+        {
+            auto* controller = control();
+            return details::GetterSetter {
+                controller,
+                [controller] { return controller->GetSelection(); },
+                [controller](int selection) { controller->SetSelection(selection); }
+            };
+        }
+
+        [[nodiscard]] auto selections() const
+        {
+            auto* controller = control();
+            return details::GetterSetter {
+                controller,
+                [controller]() -> std::vector<int> {
+                    if (!controller->HasMultipleSelection()) {
+                        auto selection = controller->GetSelection();
+                        return selection == wxNOT_FOUND ? std::vector<int> {} : std::vector<int> { selection };
+                    }
+                    auto result = std::vector<int> {};
+                    auto cookie = 0UL;
+                    for (auto item = controller->GetFirstSelected(cookie); item != wxNOT_FOUND; item = controller->GetNextSelected(cookie)) {
+                        result.push_back(item);
+                    }
+                    return result;
+                },
+                [controller](std::vector<int> const& selections) {
+                    controller->DeselectAll();
+                    for (auto&& selection : selections) {
+                        if (controller->HasMultipleSelection()) {
+                            controller->Select(static_cast<size_t>(selection));
+                        } else {
+                            controller->SetSelection(selection);
+                        }
+                    }
+                }
+            };
+        }
+
+        // Setting the count re-reads every visible row, use it after the
+        // data behind the generator has changed.
+        [[nodiscard]] auto count() const
+        {
+            auto* controller = control();
+            return details::GetterSetter {
+                controller,
+                [controller] { return controller->GetItemCount(); },
+                [controller](size_t count) {
+                    controller->SetItemCount(count);
+                    controller->RefreshAll();
+                }
+            };
+        }
+
+        auto operator*() const
+        {
+            return selection();
+        }
+    };
+
+private:
+    details::WidgetDetails<VirtualListBox, underlying_t> details_;
+    size_t count_ {};
+    underlying_t::Generator generator_;
+    std::vector<int> selection_;
+
+    template <typename Parent>
+    auto createImpl()
+    {
+        return [count = count_, &generator = generator_, &selections = selection_](Parent* parent, wxWindowID id, wxPoint pos, wxSize size, int64_t style) {
+            auto* widget = customizations::ParentCreate<underlying_t>(parent, id, pos, size, style, count, generator);
+            // Unlike wxListBox, SetSelection replaces any existing selection.
+            // Only wxLB_MULTIPLE makes a wxVListBox multiple selection;
+            // Select fails on the others, wxLB_EXTENDED included.
+            for (auto&& selection : selections) {
+                if (widget->HasMultipleSelection()) {
+                    widget->Select(static_cast<size_t>(selection));
+                } else {
+                    widget->SetSelection(selection);
+                }
+            }
+            return widget;
+        };
+    }
+
+public:
+    WXUI_FORWARD_ALL_TO_DETAILS(VirtualListBox)
+};
+
+WXUI_WIDGET_STATIC_ASSERT_BOILERPLATE(VirtualListBox);
+}
+
+#include <wxUI/detail/ZapMacros.hpp>
@@ -24,16 +24,20 @@ SOFTWARE.
 #pragma once
 
 #include <wxUI/Customizations.hpp>
+#include <wxUI/Literal.hpp>
 #include <wxUI/Proxy.hpp>
 #include <wxUI/detail/BindInfo.hpp>
+#include <wxUI/detail/PrototypeScope.hpp>
 #include <wxUI/wxUITypes.hpp>
 
 #include <array>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <vector>
 #include <wx/sizer.h>
 #include <wx/string.h>
 
@@ -60,6 +64,7 @@ concept Createable = requires(T widget, wxWindow* window) {
 // Concept to check if a type can be used as a UTF-8 text choice
 template <typename T>
 concept utf8_text_choice = std::same_as<std::remove_cvref_t<T>, wxString>
+    || std::same_as<std::remove_cvref_t<T>, Literal>
     || std::same_as<std::remove_cvref_t<T>, std::string>
     || std::same_as<std::remove_cvref_t<T>, std::string_view>
     || std::same_as<std::remove_cvref_t<T>, char const*>
@@ -71,6 +76,12 @@ inline auto toWxString(wxString const& str) -> wxString
     return str;
 }
 
+// Literals are already converted, so this is only a copy.
+inline auto toWxString(Literal str) -> wxString
+{
+    return str.str();
+}
+
 inline auto toWxString(std::string const& str) -> wxString
 {
     return wxString::FromUTF8(str);
@@ -127,6 +138,7 @@ concept input_range_of = std::ranges::input_range<R> && std::convertible_to<std:
 template <typename R>
 concept utf8_text_input_range = std::ranges::input_range<R>
     && (std::same_as<std::ranges::range_value_t<R>, wxString>
+        || std::same_as<std::ranges::range_value_t<R>, Literal>
         || std::same_as<std::ranges::range_value_t<R>, std::string>
         || std::same_as<std::ranges::range_value_t<R>, std::string_view>
         || std::same_as<std::ranges::range_value_t<R>, char const*>);
@@ -172,6 +184,45 @@ inline auto ToVector(Range&& range) -> std::vector<T>
 } // namespace wxUI::details::Ranges
 
 namespace wxUI::details {
+// SideBlock holds an optional T on the heap, with value semantics.  It is
+// for state that is rarely set, so that the common case costs one pointer.
+template <typename T>
+class SideBlock {
+public:
+    SideBlock() = default;
+    ~SideBlock() = default;
+
+    SideBlock(SideBlock const& other)
+        : block_(other.block_ ? std::make_unique<T>(*other.block_) : nullptr)
+    {
+    }
+
+    auto operator=(SideBlock const& other) -> SideBlock&
+    {
+        if (this != &other) {
+            block_ = other.block_ ? std::make_unique<T>(*other.block_) : nullptr;
+        }
+        return *this;
+    }
+
+    SideBlock(SideBlock&&) noexcept = default;
+    auto operator=(SideBlock&&) noexcept -> SideBlock& = default;
+
+    [[nodiscard]] auto get() -> T* { return block_.get(); }
+    [[nodiscard]] auto get() const -> T const* { return block_.get(); }
+
+    auto getOrCreate() -> T&
+    {
+        if (!block_) {
+            block_ = std::make_unique<T>();
+        }
+        return *block_;
+    }
+
+private:
+    std::unique_ptr<T> block_;
+};
+
 // The WidgetDetails holds the common details across many controllers.
 // The "recipe" for constructing a controller is pretty straight forward:
 // 1. give a name.
@@ -193,22 +244,22 @@ struct WidgetDetails {
 
     auto withPosition(wxPoint pos)
     {
-        pos_ = pos;
+        extras_.getOrCreate().pos = pos;
     }
 
     auto withSize(wxSize size)
     {
-        size_ = size;
+        extras_.getOrCreate().size = size;
     }
 
     auto withWidth(int size)
     {
-        size_.SetWidth(size);
+        extras_.getOrCreate().size.SetWidth(size);
     }
 
     auto withHeight(int size)
     {
-        size_.SetHeight(size);
+        extras_.getOrCreate().size.SetHeight(size);
     }
 
     auto setStyle(int64_t style)
@@ -228,7 +279,9 @@ struct WidgetDetails {
 
     auto withFont(wxFontInfo const& fontInfo)
     {
-        fontInfo_ = fontInfo;
+        auto& extras = extras_.getOrCreate();
+        extras.fontInfo = fontInfo;
+        extras.font.reset();
     }
 
     auto setEnabled(bool enabled)
@@ -238,7 +291,7 @@ struct WidgetDetails {
 
     auto withProxy(wxUI::details::Proxy<Underlying> const& proxy)
     {
-        proxyHandles_.push_back(proxy);
+        extras_.getOrCreate().proxyHandles.push_back(proxy);
     }
 
     // create uses the stored Creator to construct the underlying widget,
@@ -246,13 +299,18 @@ struct WidgetDetails {
     template <typename CreatorFunction, typename Parent>
     auto create(CreatorFunction creator, Parent* parent)
     {
-        auto* widget = creator(parent, identity_, pos_, size_, style_);
-        if (fontInfo_) {
-            widget->SetFont(wxFont(*fontInfo_));
+        auto* widget = creator(parent, identity_, getPos(), getSize(), style_);
+        auto* extras = extras_.get();
+        if (extras && extras->fontInfo) {
+            if (!extras->font) {
+                extras->font = wxFont(*extras->fontInfo);
+            }
+            widget->SetFont(*extras->font);
         }
         widget->Enable(enabled_);
         bindEvents(widget);
         bindProxy(widget);
+        PrototypeScope::created(widget);
 
         return widget;
     }
@@ -266,8 +324,8 @@ struct WidgetDetails {
     }
 
     auto getIdentity() const { return identity_; }
-    auto getPos() const { return pos_; }
-    auto getSize() const { return size_; }
+    auto getPos() const { return extras_.get() ? extras_.get()->pos : wxDefaultPosition; }
+    auto getSize() const { return extras_.get() ? extras_.get()->size : wxDefaultSize; }
     auto getStyle() const { return style_; }
     auto getFlags() const { return flags_; }
 
@@ -275,21 +333,31 @@ struct WidgetDetails {
     template <typename Function, typename Event = wxCommandEvent>
     auto bind(wxEventTypeTag<Event> event, Function&& function)
     {
+        auto& extras = extras_.getOrCreate();
+        auto add = [&extras](auto&& bindInfo) {
+            if (!extras.firstBound) {
+                extras.firstBound.emplace(std::forward<decltype(bindInfo)>(bindInfo));
+            } else {
+                extras.moreBound.push_back(std::forward<decltype(bindInfo)>(bindInfo));
+            }
+        };
         if constexpr (is_noarg_callable<std::decay_t<Function>>()) {
-            boundedFunctions_.emplace_back(event, [function = std::forward<Function>(function)](Event&) mutable {
-                function();
-            });
+            add(BindInfo { event, [function = std::forward<Function>(function)](Event&) mutable {
+                              function();
+                          } });
         } else {
-            boundedFunctions_.emplace_back(event, std::forward<Function>(function));
+            add(BindInfo { event, std::forward<Function>(function) });
         }
     }
 
     template <typename Controller>
     auto bindProxy(Controller* widget)
     {
-        for (auto& proxyHandle : proxyHandles_) {
-            using ::wxUI::customizations::ControllerBindProxy;
-            ControllerBindProxy(widget, proxyHandle);
+        if (auto* extras = extras_.get()) {
+            for (auto& proxyHandle : extras->proxyHandles) {
+                using ::wxUI::customizations::ControllerBindProxy;
+                ControllerBindProxy(widget, PrototypeScope::proxyFor(proxyHandle));
+            }
         }
         return widget;
     }
@@ -298,21 +366,47 @@ private:
     template <typename Controller>
     auto bindEvents(Controller* widget)
     {
-        for (auto& bounded : boundedFunctions_) {
-            using ::wxUI::customizations::ControllerBindEvent;
-            ControllerBindEvent(widget, bounded);
+        if (auto* extras = extras_.get()) {
+            auto* dispatcher = EventDispatcher::current();
+            auto bindOne = [widget, dispatcher](BindInfo& bounded) {
+                if (dispatcher != nullptr) {
+                    using ::wxUI::customizations::ControllerDispatchEvent;
+                    ControllerDispatchEvent(widget, *dispatcher, bounded);
+                } else {
+                    using ::wxUI::customizations::ControllerBindEvent;
+                    ControllerBindEvent(widget, bounded);
+                }
+            };
+            if (extras->firstBound) {
+                bindOne(*extras->firstBound);
+            }
+            for (auto& bounded : extras->moreBound) {
+                bindOne(bounded);
+            }
         }
         return widget;
     }
 
+    // The settings most controllers never use.
+    struct Extras {
+        wxPoint pos = wxDefaultPosition;
+        wxSize size = wxDefaultSize;
+        std::optional<wxFontInfo> fontInfo {};
+        // made from fontInfo the first time the controller is created, and
+        // kept for the next time.
+        std::optional<wxFont> font {};
+        std::vector<details::Proxy<Underlying>> proxyHandles {};
+        // Most controllers bind at most one handler, so the first is kept
+        // here rather than in a vector of its own; binding it only allocates
+        // this block, if nothing else has.
+        std::optional<BindInfo> firstBound {};
+        std::vector<BindInfo> moreBound {};
+    };
+
     std::optional<wxSizerFlags> flags_;
-    wxWindowID identity_ = wxID_ANY;
-    wxPoint pos_ = wxDefaultPosition;
-    wxSize size_ = wxDefaultSize;
     int64_t style_ {};
+    SideBlock<Extras> extras_;
+    wxWindowID identity_ = wxID_ANY;
     bool enabled_ = true;
-    std::optional<wxFontInfo> fontInfo_ {};
-    std::vector<details::Proxy<Underlying>> proxyHandles_ {};
-    std::vector<BindInfo> boundedFunctions_;
 };
 }
@@ -25,7 +25,11 @@ SOFTWARE.
 
 #include <memory>
 #include <optional>
+#include <type_traits>
+#include <utility>
 #include <wx/sizer.h>
+#include <wxUI/detail/EventDispatcher.hpp>
+#include <wxUI/detail/SmallStorage.hpp>
 
 namespace wxUI::details {
 
@@ -50,51 +54,34 @@ constexpr bool is_noarg_callable()
 }
 
 // BindInfo uses type erase to allow any binding for any Event type.
+// Handlers that fit in kInlineSize are stored inline, so binding and copying
+// the usual small lambdas does not allocate.
 struct BindInfo {
+    static constexpr auto kInlineSize = 8 * sizeof(void*);
 
     void bindTo(wxWindow* widget) const
     {
         info_->bindTo(widget);
     }
 
-    template <typename Event, typename Function>
-    BindInfo(Event event, Function&& function)
-        : info_(std::make_unique<BindInfoDetails<Event, std::decay_t<Function>>>(event, std::forward<Function>(function)))
-    {
-    }
-
-    ~BindInfo() = default;
-
-    BindInfo(BindInfo const& bindInfo)
-        : info_(bindInfo.info_->clone())
+    // Adds the handler to a container's dispatcher for the control with
+    // `identity`.  Returns false, adding nothing, for events that do not
+    // propagate up to the container; those have to be bound to the control.
+    auto addTo(EventDispatcher& dispatcher, int identity, void const* source) const -> bool
     {
+        return info_->addTo(dispatcher, identity, source);
     }
 
-    auto operator=(BindInfo const& bindInfo) -> BindInfo&
-    {
-        if (this == &bindInfo) {
-            return *this;
-        }
-        info_ = bindInfo.info_->clone();
-        return *this;
-    }
-
-    BindInfo(BindInfo&& bindInfo) noexcept
-        : info_(std::move(bindInfo.info_))
-    {
-    }
-
-    auto operator=(BindInfo&& bindInfo) noexcept -> BindInfo&
+    template <typename Event, typename Function>
+    BindInfo(Event event, Function&& function)
+        : info_(std::in_place_type<BindInfoDetails<Event, std::decay_t<Function>>>, event, std::forward<Function>(function))
     {
-        info_ = std::move(bindInfo.info_);
-        return *this;
     }
 
 private:
-    struct BindInfoDetailsBase {
-        virtual ~BindInfoDetailsBase() = default;
+    struct BindInfoDetailsBase : Storable<BindInfoDetailsBase> {
         virtual void bindTo(wxWindow* widget) const = 0;
-        [[nodiscard]] virtual auto clone() const -> std::unique_ptr<BindInfoDetailsBase> = 0;
+        virtual auto addTo(EventDispatcher& dispatcher, int identity, void const* source) const -> bool = 0;
     };
 
     template <typename Event, typename Function>
@@ -111,13 +98,21 @@ private:
         {
             widget->Bind(event, function);
         }
-        [[nodiscard]] auto clone() const -> std::unique_ptr<BindInfoDetailsBase> override
+        auto addTo(EventDispatcher& dispatcher, int identity, void const* source) const -> bool override
         {
-            return std::make_unique<BindInfoDetails>(event, function);
+            if constexpr (requires { typename Event::EventClass; } && std::is_base_of_v<wxCommandEvent, typename Event::EventClass>) {
+                using EventClass = typename Event::EventClass;
+                dispatcher.add(event, identity, source, [function = function](wxEvent& event) mutable {
+                    function(static_cast<EventClass&>(event));
+                });
+                return true;
+            } else {
+                return false;
+            }
         }
     };
 
-    std::unique_ptr<BindInfoDetailsBase> info_;
+    SmallStorage<BindInfoDetailsBase, kInlineSize> info_;
 };
 
 static_assert(std::is_nothrow_move_constructible_v<BindInfo>);
@@ -23,6 +23,8 @@ SOFTWARE.
 */
 #pragma once
 
+#include <memory>
+#include <utility>
 #include <variant>
 #include <wx/sizer.h>
 #include <wx/statbox.h>
@@ -61,35 +63,79 @@ struct BookItem {
     {
     }
 
+    // Defer building the page's contents until the page is first selected.
+    // The page starts out as an empty placeholder window.
+    auto withLazy() & -> BookItem&
+    {
+        lazy_ = true;
+        return *this;
+    }
+
+    auto withLazy() && -> BookItem&&
+    {
+        lazy_ = true;
+        return std::move(*this);
+    }
+
     template <typename Parent, typename Sizer>
     auto createAndAdd(Parent* parent, [[maybe_unused]] Sizer* parentSizer, [[maybe_unused]] wxSizerFlags const& parentFlags)
     {
         auto page = customizations::ParentCreate<wxWindow>(parent, wxID_ANY);
 
+        if (!lazy_) {
+            populate(page, item_);
+        }
+
+        if constexpr (requires(Parent p) { p.AddPage(page, title_, select_); }) {
+            parent->AddPage(page, title_, select_);
+            if (lazy_) {
+                bindLazy(parent, page);
+            }
+        } else {
+            throw std::runtime_error("Cannot add book item to normal window, use a parent that uses wxBookCtrlBase");
+        }
+    }
+
+private:
+    template <typename Parent, typename Page>
+    void bindLazy(Parent* parent, Page* page)
+    {
+        // The layout this item belongs to may not outlive the book, so the
+        // pending page keeps its own copy of the item.
+        using ItemValue = std::remove_cvref_t<Item>;
+        auto item = [this] {
+            if constexpr (std::is_copy_constructible_v<ItemValue>) {
+                return std::make_shared<ItemValue>(std::as_const(item_));
+            } else {
+                return std::make_shared<ItemValue>(std::move(item_));
+            }
+        }();
+        customizations::BookBindLazyPage(parent, page, [page, item] {
+            populate(page, *item);
+        });
+    }
+
+    template <typename Page, typename UItem>
+    static void populate(Page* page, UItem& item)
+    {
         // If the item has fitTo (i.e., it's a sizer), use it directly
-        if constexpr (requires { item_.fitTo(page); }) {
-            item_.fitTo(page);
+        if constexpr (requires { item.fitTo(page); }) {
+            item.fitTo(page);
         } else {
             // Otherwise, create a sizer for the page and add the item to it
             using ::wxUI::customizations::BoxSizerInfo;
             using ::wxUI::customizations::SizerCreate;
             auto sizer = SizerCreate(page, BoxSizerInfo { std::nullopt, wxVERTICAL });
             auto flags = wxSizerFlags { 1 }.Expand();
-            details::createAndAddVisiter(item_, page, sizer, flags);
+            details::createAndAddVisiter(item, page, sizer, flags);
             page->SetSizerAndFit(sizer);
         }
-
-        if constexpr (requires(Parent p) { p.AddPage(page, title_, select_); }) {
-            parent->AddPage(page, title_, select_);
-        } else {
-            throw std::runtime_error("Cannot add book item to normal window, use a parent that uses wxBookCtrlBase");
-        }
     }
 
-private:
     wxString title_ {};
     Item item_;
     bool select_ {};
+    bool lazy_ {};
 };
 
 template <details::SizerItem Item>
@@ -110,14 +156,14 @@ namespace details {
     struct BookCtrl {
         template <SizerItem... UItems>
         explicit BookCtrl(UItems&&... items)
-            : items_(std::forward_as_tuple(std::forward<UItems>(items)...))
+            : items_(std::forward<UItems>(items)...)
         {
         }
 
         template <SizerItem... UItems>
         explicit BookCtrl(wxSizerFlags const& flags, UItems&&... items)
             : flags_(flags)
-            , items_(std::forward_as_tuple(std::forward<UItems>(items)...))
+            , items_(std::forward<UItems>(items)...)
         {
         }
 
@@ -142,16 +188,13 @@ namespace details {
         {
             auto* book = constructBook(parent);
 
-            std::apply([book, flags](auto&&... tupleArg) {
-                (createAndAddVisiter(tupleArg, book, static_cast<wxSizer*>(nullptr), flags), ...);
-            },
-                items_);
+            items_.createAndAdd(book, static_cast<wxSizer*>(nullptr), flags);
 
             return book;
         }
 
         std::optional<wxSizerFlags> flags_ {};
-        std::tuple<Items...> items_ {};
+        SizerItems<Items...> items_;
     };
 
 } // namespace details
@@ -0,0 +1,197 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+
+#include <wx/ctrlsub.h>
+#include <wx/string.h>
+#include <wx/wupdlock.h>
+
+#include <map>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace wxUI {
+
+// How a choices() accessor applies a new list.  Replace sets the whole
+// list at once; Diff only inserts and deletes the rows that changed, and
+// keeps the selection if the selected row is still there.
+enum class ChoicesUpdate {
+    Replace,
+    Diff,
+};
+
+}
+
+namespace wxUI::details {
+
+// The item functions are called through wxItemContainer where possible, as
+// some controls (wxBitmapComboBox) hide the plain overloads.
+template <typename Control>
+auto itemsOf(Control* control)
+{
+    if constexpr (std::is_convertible_v<Control*, wxItemContainer*>) {
+        return static_cast<wxItemContainer*>(control);
+    } else {
+        return control;
+    }
+}
+
+template <typename Control>
+auto getChoices(Control* control) -> std::vector<std::string>
+{
+    auto* items = itemsOf(control);
+    auto result = std::vector<std::string> {};
+    result.reserve(items->GetCount());
+    for (auto i = 0U; i < items->GetCount(); ++i) {
+        result.push_back(items->GetString(i).utf8_string());
+    }
+    return result;
+}
+
+template <typename Control>
+auto selectedRows(Control* control) -> std::vector<int>
+{
+    if constexpr (requires(wxArrayInt& rows) { control->GetSelections(rows); }) {
+        auto rows = wxArrayInt {};
+        control->GetSelections(rows);
+        return { rows.begin(), rows.end() };
+    } else {
+        auto row = itemsOf(control)->GetSelection();
+        return row == wxNOT_FOUND ? std::vector<int> {} : std::vector<int> { row };
+    }
+}
+
+template <typename Control>
+void selectRows(Control* control, std::vector<int> const& rows)
+{
+    if (selectedRows(control) == rows) {
+        return;
+    }
+    auto* items = itemsOf(control);
+    items->SetSelection(wxNOT_FOUND);
+    if constexpr (requires(wxArrayInt& selected) { control->GetSelections(selected); }) {
+        for (auto row : rows) {
+            items->SetSelection(row);
+        }
+    } else if (!rows.empty()) {
+        items->SetSelection(rows.front());
+    }
+}
+
+template <typename Control>
+void replaceChoices(Control* control, std::vector<wxString> const& choices)
+{
+    auto strings = wxArrayString {};
+    strings.reserve(choices.size());
+    for (auto const& choice : choices) {
+        strings.Add(choice);
+    }
+    itemsOf(control)->Set(strings);
+}
+
+// Turns the items of `control` into `choices` with inserts and deletes.
+// Walks both lists once: a row that matches is kept, a row that is not
+// wanted any more is deleted, and anything else is inserted.  Narrowing or
+// widening a list, as a filter does, takes only the necessary operations.
+template <typename Control>
+void diffChoices(Control* control, std::vector<wxString> const& choices)
+{
+    auto* items = itemsOf(control);
+    auto current = std::vector<wxString> {};
+    current.reserve(items->GetCount());
+    for (auto i = 0U; i < items->GetCount(); ++i) {
+        current.push_back(items->GetString(i));
+    }
+    auto selected = std::vector<bool>(current.size());
+    auto hadSelection = false;
+    for (auto row : selectedRows(control)) {
+        selected[static_cast<size_t>(row)] = true;
+        hadSelection = true;
+    }
+
+    // how many times each string is still wanted from choices[next] on
+    auto wanted = std::map<wxString, size_t> {};
+    for (auto const& choice : choices) {
+        ++wanted[choice];
+    }
+
+    auto selection = std::vector<int> {};
+    auto row = 0U;
+    auto old = size_t {};
+    auto next = size_t {};
+    while (old < current.size() && next < choices.size()) {
+        if (current[old] == choices[next]) {
+            if (selected[old]) {
+                selection.push_back(static_cast<int>(row));
+            }
+            --wanted[choices[next]];
+            ++row;
+            ++old;
+            ++next;
+        } else if (auto found = wanted.find(current[old]); found == wanted.end() || found->second == 0) {
+            items->Delete(row);
+            ++old;
+        } else {
+            items->Insert(choices[next], row);
+            --wanted[choices[next]];
+            ++row;
+            ++next;
+        }
+    }
+    for (; old < current.size(); ++old) {
+        items->Delete(row);
+    }
+    for (; next < choices.size(); ++next, ++row) {
+        items->Insert(choices[next], row);
+    }
+    if (hadSelection) {
+        selectRows(control, selection);
+    }
+}
+
+template <typename Control>
+void setChoices(Control* control, std::vector<std::string> const& choices, ChoicesUpdate how)
+{
+    auto converted = std::vector<wxString> {};
+    converted.reserve(choices.size());
+    for (auto const& choice : choices) {
+        converted.push_back(wxString::FromUTF8(choice));
+    }
+    auto update = [&] {
+        if (how == ChoicesUpdate::Diff) {
+            diffChoices(control, converted);
+        } else {
+            replaceChoices(control, converted);
+        }
+    };
+    if constexpr (std::is_convertible_v<Control*, wxWindow*>) {
+        auto noUpdates = wxWindowUpdateLocker { control };
+        update();
+    } else {
+        update();
+    }
+}
+
+}
@@ -0,0 +1,146 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <ranges>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <wx/event.h>
+
+namespace wxUI::details {
+
+// EventDispatcher lets a container handle the events of the controls laid
+// out in it with one handler per event type, instead of every control
+// keeping a dynamic event table of its own.  Command events propagate from a
+// control up through its parents, so the container's handler sees them and
+// looks up the handlers registered for the window id, checking the event
+// came from the control they were registered for (wx reuses the ids of
+// destroyed windows).
+//
+// As with Bind, the handler added last is called first, and the next one is
+// only called if it skips the event.  A control's destroy event propagates
+// to the container as well, which removes the control's handlers then, so
+// containers whose children are rebuilt do not collect them.
+class EventDispatcher {
+public:
+    using Handler = std::function<void(wxEvent&)>;
+
+    void add(wxEventType type, int identity, void const* source, Handler handler)
+    {
+        tables_[type][identity].push_back({ source, std::move(handler) });
+        keys_[source].emplace_back(type, identity);
+    }
+
+    void remove(void const* source)
+    {
+        auto keys = keys_.find(source);
+        if (keys == keys_.end()) {
+            return;
+        }
+        for (auto [type, identity] : keys->second) {
+            auto& table = tables_[type];
+            if (auto entries = table.find(identity); entries != table.end()) {
+                std::erase_if(entries->second, [source](auto const& entry) { return entry.source == source; });
+                if (entries->second.empty()) {
+                    table.erase(entries);
+                }
+            }
+        }
+        keys_.erase(keys);
+    }
+
+    // Returns false if no handler took the event, so the caller can let it
+    // carry on to other handlers.
+    auto dispatch(wxEventType type, int identity, void const* source, wxEvent& event) const -> bool
+    {
+        auto table = tables_.find(type);
+        if (table == tables_.end()) {
+            return false;
+        }
+        auto entries = table->second.find(identity);
+        if (entries == table->second.end()) {
+            return false;
+        }
+        for (auto const& entry : entries->second | std::views::reverse) {
+            if (entry.source != source) {
+                continue;
+            }
+            event.Skip(false);
+            entry.handler(event);
+            if (!event.GetSkipped()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    [[nodiscard]] auto eventTypes() const -> std::vector<wxEventType>
+    {
+        auto types = std::vector<wxEventType> {};
+        types.reserve(tables_.size());
+        for (auto const& [type, _] : tables_) {
+            types.push_back(type);
+        }
+        return types;
+    }
+
+    // While a Scope is alive, controls created on this thread add their
+    // handlers to the dispatcher rather than binding them to themselves.
+    class Scope {
+    public:
+        explicit Scope(EventDispatcher* dispatcher)
+            : previous_(std::exchange(currentSlot(), dispatcher))
+        {
+        }
+        ~Scope() { currentSlot() = previous_; }
+        Scope(Scope const&) = delete;
+        Scope(Scope&&) = delete;
+        auto operator=(Scope const&) -> Scope& = delete;
+        auto operator=(Scope&&) -> Scope& = delete;
+
+    private:
+        EventDispatcher* previous_;
+    };
+
+    static auto current() -> EventDispatcher* { return currentSlot(); }
+
+private:
+    static auto currentSlot() -> EventDispatcher*&
+    {
+        thread_local EventDispatcher* current = nullptr;
+        return current;
+    }
+
+    struct Entry {
+        void const* source;
+        Handler handler;
+    };
+    std::unordered_map<wxEventType, std::unordered_map<int, std::vector<Entry>>> tables_;
+    std::unordered_map<void const*, std::vector<std::pair<wxEventType, int>>> keys_;
+};
+
+}
@@ -78,6 +78,21 @@ SOFTWARE.
     }
 #endif
 
+// As WXUI_FORWARD_TO_DETAILS, for builder calls that take no argument.
+#if !defined(WXUI_FORWARD_NOARG_TO_DETAILS)
+#define WXUI_FORWARD_NOARG_TO_DETAILS(ControllerType, MethodName) \
+    auto MethodName() & -> ControllerType&                        \
+    {                                                             \
+        details_.MethodName();                                    \
+        return *this;                                             \
+    }                                                             \
+    auto MethodName() && -> ControllerType&&                      \
+    {                                                             \
+        details_.MethodName();                                    \
+        return std::move(*this);                                  \
+    }
+#endif
+
 // Forward the two-argument bind(event, handler) templates to details_.
 #if !defined(WXUI_FORWARD_BIND_TO_DETAILS)
 #define WXUI_FORWARD_BIND_TO_DETAILS(ControllerType)                             \
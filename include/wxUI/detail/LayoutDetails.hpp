@@ -23,11 +23,15 @@ SOFTWARE.
 */
 #pragma once
 
+#include <memory>
+#include <utility>
 #include <variant>
 #include <wx/sizer.h>
 #include <wx/statbox.h>
 #include <wxUI/Widget.hpp>
+#include <wxUI/detail/EventDispatcher.hpp>
 #include <wxUI/detail/HelperMacros.hpp>
+#include <wxUI/detail/PrototypeScope.hpp>
 #include <wxUI/wxUITypes.hpp>
 
 namespace wxUI::details {
@@ -77,18 +81,129 @@ using SizerProxy = details::Proxy<wxSizer>;
 
 namespace wxUI::details {
 
+// Flat storage for the items of a layout.  std::tuple is built by recursion, so
+// N items instantiate N nested bases, each with its own constructors, getters
+// and destructor, for every distinct layout.  Here every item is one direct
+// base, found again by its index, and the cost grows linearly with the items.
+template <std::size_t Index, typename Item>
+struct SizerItemSlot {
+    Item item;
+};
+
+template <std::size_t Index, typename Item>
+auto getSizerItem(SizerItemSlot<Index, Item>& slot) -> Item&
+{
+    return slot.item;
+}
+
+template <typename Indices, typename... Items>
+struct SizerItemsImpl;
+
+template <std::size_t... Index, typename... Items>
+struct SizerItemsImpl<std::index_sequence<Index...>, Items...> : SizerItemSlot<Index, Items>... {
+    template <typename... UItems>
+        requires(sizeof...(UItems) == sizeof...(Items) && (std::constructible_from<Items, UItems> && ...))
+    explicit SizerItemsImpl(UItems&&... items)
+        : SizerItemSlot<Index, Items> { std::forward<UItems>(items) }...
+    {
+    }
+
+    template <typename Parent, typename Sizer>
+    void createAndAdd([[maybe_unused]] Parent* parent, [[maybe_unused]] Sizer* sizer, [[maybe_unused]] wxSizerFlags const& flags)
+    {
+        (details::createAndAddVisiter(getSizerItem<Index>(*this), parent, sizer, flags), ...);
+    }
+};
+
+template <typename... Items>
+using SizerItems = SizerItemsImpl<std::index_sequence_for<Items...>, Items...>;
+
+// The parts of a sizer that do not depend on what it lays out.  Sizer<Items...>
+// is instantiated for every distinct layout, so anything that can live here is
+// compiled once per Parent/Sizer type instead.
+class SizerBase {
+protected:
+    SizerBase() = default;
+    explicit SizerBase(wxSizerFlags const& flags)
+        : flags_(flags)
+    {
+    }
+
+    [[nodiscard]] auto currentFlags(wxSizerFlags const& parentFlags) const -> wxSizerFlags
+    {
+        return flags_.value_or(parentFlags);
+    }
+
+    // nested sizers without a dispatcher of their own use the outer one.
+    [[nodiscard]] auto makeDispatcher() const -> std::shared_ptr<EventDispatcher>
+    {
+        return dispatcher_ ? std::make_shared<EventDispatcher>() : nullptr;
+    }
+
+    // `items` is anything with createAndAdd(parent, sizer, flags): the fixed
+    // SizerItems of a Sizer<Items...>, or the items of a DynamicVSizer.
+    template <typename CreatorFunction, typename Items, typename Parent, typename Sizer>
+    auto createAndAddItems(CreatorFunction const& creator, Items& items, Parent* parent, Sizer* parentSizer, wxSizerFlags const& parentFlags)
+    {
+        auto flags = currentFlags(parentFlags);
+        auto* sizer = createAndAddWidgets(creator, items, parent, flags);
+        parentSizer->Add(sizer, flags);
+        return sizer;
+    }
+
+    template <typename CreatorFunction, typename Items, typename Parent>
+    auto fitItemsTo(CreatorFunction const& creator, Items& items, Parent* parent) -> Parent*
+    {
+        auto* sizer = createAndAddWidgets(creator, items, parent, currentFlags(wxSizerFlags {}));
+        parent->SetSizer(sizer);
+        sizer->SetSizeHints(parent);
+        return parent;
+    }
+
+    std::optional<wxSizerFlags> flags_ {};
+    std::vector<SizerProxy> proxyHandles_ {};
+    bool dispatcher_ = false;
+
+private:
+    template <typename CreatorFunction, typename Items, typename Parent>
+    auto createAndAddWidgets(CreatorFunction const& creator, Items& items, Parent* parent, wxSizerFlags const& flags)
+    {
+        auto sizer = creator(parent);
+        auto dispatcher = makeDispatcher();
+        {
+            auto scope = EventDispatcher::Scope { dispatcher ? dispatcher.get() : EventDispatcher::current() };
+            items.createAndAdd(parent, sizer, flags);
+        }
+        return finish(parent, sizer, std::move(dispatcher));
+    }
+
+    template <typename Parent, typename Sizer>
+    auto finish(Parent* parent, Sizer* sizer, std::shared_ptr<EventDispatcher> dispatcher) -> Sizer*
+    {
+        if (dispatcher) {
+            using ::wxUI::customizations::ContainerBindDispatcher;
+            ContainerBindDispatcher(parent, std::move(dispatcher));
+        }
+        for (auto& proxyHandle : proxyHandles_) {
+            using ::wxUI::customizations::SizerBindProxy;
+            SizerBindProxy(sizer, PrototypeScope::proxyFor(proxyHandle));
+        }
+        return sizer;
+    }
+};
+
 template <details::SizerItem... Items>
-struct Sizer {
+struct Sizer : private SizerBase {
     template <details::SizerItem... UItems>
     explicit Sizer(UItems&&... items)
-        : items_(std::forward_as_tuple(std::forward<UItems>(items)...))
+        : items_(std::forward<UItems>(items)...)
     {
     }
 
     template <details::SizerItem... UItems>
     explicit Sizer(wxSizerFlags const& flags, UItems&&... items)
-        : flags_(flags)
-        , items_(std::forward_as_tuple(std::forward<UItems>(items)...))
+        : SizerBase(flags)
+        , items_(std::forward<UItems>(items)...)
     {
     }
 
@@ -116,50 +231,54 @@ struct Sizer {
         return std::move(*this);
     }
 
+    // The events of the controllers laid out here are handled by one
+    // dispatcher bound to the parent, rather than bound to each controller.
+    auto withDispatcher() & -> Sizer&
+    {
+        dispatcher_ = true;
+        return *this;
+    }
+
+    auto withDispatcher() && -> Sizer&&
+    {
+        dispatcher_ = true;
+        return std::move(*this);
+    }
+
     template <typename CreatorFunction, typename Parent, typename Sizer>
-    auto createAndAdd(CreatorFunction creator, Parent* parent, Sizer* parentSizer, wxSizerFlags const& parentFlags)
+    auto createAndAdd(CreatorFunction const& creator, Parent* parent, Sizer* parentSizer, wxSizerFlags const& parentFlags)
     {
-        auto currentFlags = flags_.value_or(parentFlags);
-        auto* sizer = createAndAddWidgets(creator, parent, currentFlags);
-        parentSizer->Add(sizer, currentFlags);
-        return sizer;
+        return createAndAddItems(creator, items_, parent, parentSizer, parentFlags);
     }
 
     template <typename CreatorFunction, typename Parent>
-    auto fitTo(CreatorFunction creator, Parent* parent) -> Parent*
+    auto fitTo(CreatorFunction const& creator, Parent* parent) -> Parent*
     {
-        auto* sizer = createAndAddWidgets(creator, parent, flags_.value_or(wxSizerFlags {}));
-        parent->SetSizer(sizer);
-        sizer->SetSizeHints(parent);
-        return parent;
+        return fitItemsTo(creator, items_, parent);
     }
 
 private:
-    template <typename CreatorFunction, typename Parent>
-    auto createAndAddWidgets(CreatorFunction creator, Parent* parent, wxSizerFlags const& flags)
-    {
-        auto sizer = creator(parent);
+    SizerItems<Items...> items_;
+};
 
-        std::apply([parent, sizer, flags](auto&&... tupleArg) {
-            (details::createAndAddVisiter(tupleArg, parent, sizer, flags), ...);
-        },
-            items_);
-        return bindProxy(sizer);
-    }
+// How a BoxSizer makes its wxSizer.  It is kept out of BoxSizer<Items...> so it
+// is instantiated once per Parent type rather than once per layout.
+struct BoxSizerCreator {
+    wxOrientation orientation {};
+    bool wrap = false;
+    std::optional<wxString> caption = std::nullopt;
 
-    template <typename Sizer>
-    auto bindProxy(Sizer* sizer)
+    template <typename Parent>
+    auto operator()(Parent* parent) const
     {
-        for (auto& proxyHandle : proxyHandles_) {
-            using ::wxUI::customizations::SizerBindProxy;
-            SizerBindProxy(sizer, proxyHandle);
+        using ::wxUI::customizations::BoxSizerInfo;
+        using ::wxUI::customizations::WrapSizerInfo;
+        using ::wxUI::customizations::SizerCreate;
+        if (wrap) {
+            return SizerCreate(parent, WrapSizerInfo { orientation });
         }
-        return sizer;
+        return SizerCreate(parent, BoxSizerInfo { caption, orientation });
     }
-
-    std::optional<wxSizerFlags> flags_ {};
-    std::tuple<Items...> items_ {};
-    std::vector<SizerProxy> proxyHandles_ {};
 };
 
 struct withWrap { };
@@ -168,99 +287,78 @@ struct BoxSizer {
     template <details::SizerItem... UItems>
     explicit BoxSizer(wxOrientation orientation, UItems&&... items)
         : details_(std::forward<UItems>(items)...)
-        , orientation_(orientation)
+        , creator_ { orientation, false, std::nullopt }
     {
     }
 
     template <details::SizerItem... UItems>
     BoxSizer(wxOrientation orientation, wxSizerFlags const& flags, UItems&&... items)
         : details_(flags, std::forward<UItems>(items)...)
-        , orientation_(orientation)
+        , creator_ { orientation, false, std::nullopt }
     {
     }
 
     template <details::SizerItem... UItems>
     BoxSizer(wxOrientation orientation, std::string_view caption, UItems&&... items)
         : details_(std::forward<UItems>(items)...)
-        , orientation_(orientation)
-        , caption_(toWxString(caption))
+        , creator_ { orientation, false, toWxString(caption) }
     {
     }
 
     template <details::SizerItem... UItems>
     BoxSizer(wxOrientation orientation, wxUI_String, wxString caption, UItems&&... items)
         : details_(std::forward<UItems>(items)...)
-        , orientation_(orientation)
-        , caption_(std::move(caption))
+        , creator_ { orientation, false, std::move(caption) }
     {
     }
 
     template <details::SizerItem... UItems>
     BoxSizer(wxOrientation orientation, std::string_view caption, wxSizerFlags const& flags, UItems&&... items)
         : details_(flags, std::forward<UItems>(items)...)
-        , orientation_(orientation)
-        , caption_(toWxString(caption))
+        , creator_ { orientation, false, toWxString(caption) }
     {
     }
 
     template <details::SizerItem... UItems>
     BoxSizer(wxOrientation orientation, wxUI_String, wxString caption, wxSizerFlags const& flags, UItems&&... items)
         : details_(flags, std::forward<UItems>(items)...)
-        , orientation_(orientation)
-        , caption_(std::move(caption))
+        , creator_ { orientation, false, std::move(caption) }
     {
     }
 
     template <details::SizerItem... UItems>
     BoxSizer(withWrap, wxOrientation orientation, UItems&&... items)
         : details_(std::forward<UItems>(items)...)
-        , orientation_(orientation)
-        , wrap_(true)
+        , creator_ { orientation, true, std::nullopt }
     {
     }
 
     template <details::SizerItem... UItems>
     BoxSizer(withWrap, wxOrientation orientation, wxSizerFlags const& flags, UItems&&... items)
         : details_(flags, std::forward<UItems>(items)...)
-        , orientation_(orientation)
-        , wrap_(true)
+        , creator_ { orientation, true, std::nullopt }
     {
     }
 
     template <typename Parent, typename Sizer>
     auto createAndAdd(Parent* parent, Sizer* sizer, wxSizerFlags const& parentFlags)
     {
-        return details_.createAndAdd(this->template createImpl<Parent>(), parent, sizer, parentFlags);
+        return details_.createAndAdd(creator_, parent, sizer, parentFlags);
     }
 
     template <typename Parent>
     auto fitTo(Parent* parent) -> Parent*
     {
-        return details_.fitTo(this->template createImpl<Parent>(), parent);
+        return details_.fitTo(creator_, parent);
     }
 
     WXUI_FORWARD_TO_DETAILS(BoxSizer, withFlags, wxSizerFlags, flags)
     WXUI_FORWARD_TO_DETAILS(BoxSizer, withProxy, SizerProxy, proxy)
+    WXUI_FORWARD_NOARG_TO_DETAILS(BoxSizer, withDispatcher)
 
 private:
-    template <typename Parent>
-    auto createImpl()
-    {
-        return [this](Parent* parent) {
-            using ::wxUI::customizations::BoxSizerInfo;
-            using ::wxUI::customizations::WrapSizerInfo;
-            using ::wxUI::customizations::SizerCreate;
-            if (wrap_) {
-                return SizerCreate(parent, WrapSizerInfo { orientation_ });
-            }
-            return SizerCreate(parent, BoxSizerInfo { caption_, orientation_ });
-        };
-    }
-
     details::Sizer<Items...> details_;
-    wxOrientation orientation_ {};
-    bool wrap_ = false;
-    std::optional<wxString> caption_ = std::nullopt;
+    BoxSizerCreator creator_;
 };
 
 }
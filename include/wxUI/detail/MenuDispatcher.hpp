@@ -0,0 +1,126 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+#include <wx/event.h>
+
+namespace wxUI::details {
+
+// We provide a way to bind either a function that takes in a commandEvent
+// not to a frame at a specific id
+using function_t = std::variant<std::function<void(wxCommandEvent&)>, std::function<void()>>;
+
+// MenuDispatcher holds the handlers of a whole menu bar so the frame needs
+// only one wxEVT_MENU handler, instead of one dynamic event table entry per
+// item that wx searches linearly.  The ids wxUI numbers itself run up from
+// wxID_AUTO_LOWEST, so they index a vector; stock ids go in a hash map.
+// As with Bind, the handler added last for an id is the one called.
+class MenuDispatcher {
+public:
+    void add(int identity, function_t function)
+    {
+        if (isNumbered(identity)) {
+            auto index = static_cast<std::size_t>(identity - wxID_AUTO_LOWEST);
+            if (index >= numbered_.size()) {
+                numbered_.resize(index + 1);
+            }
+            numbered_[index] = std::move(function);
+        } else {
+            stock_.insert_or_assign(identity, std::move(function));
+        }
+    }
+
+    [[nodiscard]] auto find(int identity) const -> function_t const*
+    {
+        if (isNumbered(identity)) {
+            auto index = static_cast<std::size_t>(identity - wxID_AUTO_LOWEST);
+            if (index < numbered_.size() && std::visit([](auto const& function) { return static_cast<bool>(function); }, numbered_[index])) {
+                return &numbered_[index];
+            }
+            return nullptr;
+        }
+        auto found = stock_.find(identity);
+        return found != stock_.end() ? &found->second : nullptr;
+    }
+
+    // Calls the handler for identity, returning false if there is none so
+    // the caller can let the event carry on to other handlers.
+    auto dispatch(int identity, wxCommandEvent& event) const -> bool
+    {
+        auto const* function = find(identity);
+        if (function == nullptr) {
+            return false;
+        }
+        if (auto const* withEvent = std::get_if<std::function<void(wxCommandEvent&)>>(function)) {
+            (*withEvent)(event);
+        } else {
+            std::get<std::function<void()>>(*function)();
+        }
+        return true;
+    }
+
+    // While a Scope is alive, menu items created on this thread add their
+    // handlers to the dispatcher rather than binding them to the frame.
+    // A null dispatcher means binding to the frame.
+    class Scope {
+    public:
+        explicit Scope(MenuDispatcher* dispatcher)
+            : previous_(std::exchange(currentSlot(), dispatcher))
+        {
+        }
+        ~Scope() { currentSlot() = previous_; }
+        Scope(Scope const&) = delete;
+        Scope(Scope&&) = delete;
+        auto operator=(Scope const&) -> Scope& = delete;
+        auto operator=(Scope&&) -> Scope& = delete;
+
+    private:
+        MenuDispatcher* previous_;
+    };
+
+    static auto current() -> MenuDispatcher* { return currentSlot(); }
+
+private:
+    static auto isNumbered(int identity) -> bool
+    {
+        return identity >= wxID_AUTO_LOWEST && identity <= wxID_AUTO_HIGHEST;
+    }
+
+    static auto currentSlot() -> MenuDispatcher*&
+    {
+        thread_local MenuDispatcher* current = nullptr;
+        return current;
+    }
+
+    std::vector<function_t> numbered_;
+    std::unordered_map<int, function_t> stock_;
+};
+
+}
@@ -0,0 +1,165 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace wxUI::details {
+
+// PostQueue carries writes from any thread to the UI thread.  Producers
+// push without locking (an intrusive multi-producer single-consumer queue);
+// the UI thread takes everything queued so far in drain().  Only the push
+// that finds the queue idle asks for a drain, so however fast the writes
+// come there is at most one pending wake-up.
+class PostQueue {
+public:
+    static auto instance() -> PostQueue&
+    {
+        static auto queue = PostQueue {};
+        return queue;
+    }
+
+    PostQueue()
+        : head_(&stub_)
+        , tail_(&stub_)
+    {
+    }
+
+    ~PostQueue()
+    {
+        while (auto* node = pop()) {
+            delete node;
+        }
+    }
+
+    PostQueue(PostQueue const&) = delete;
+    PostQueue(PostQueue&&) = delete;
+    auto operator=(PostQueue const&) -> PostQueue& = delete;
+    auto operator=(PostQueue&&) -> PostQueue& = delete;
+
+    // Tells at drain time whether the control a write is for still exists.
+    struct Alive {
+        std::shared_ptr<void const> attachment;
+        auto (*check)(void const* attachment, void const* control) -> bool {};
+    };
+
+    // Queues `write`.  Writes with `latest` set replace earlier ones for the
+    // same control and accessor that have not been applied yet, unless
+    // `accessor` is nullptr.  Writes whose `alive` check fails are dropped.
+    // Returns true if the caller needs to arrange for drain() to run.
+    auto push(void const* control, void const* accessor, bool latest, std::function<void()> write, Alive alive) -> bool
+    {
+        auto* node = new Node { {}, control, accessor, latest, std::move(write), std::move(alive) };
+        pending_.fetch_add(1, std::memory_order_relaxed);
+        link(node);
+        return !armed_.exchange(true, std::memory_order_acq_rel);
+    }
+
+    // Applies the queued writes in order.  UI thread only.  Returns true if
+    // more writes arrived that need another drain.
+    auto drain() -> bool
+    {
+        armed_.store(false, std::memory_order_seq_cst);
+        auto nodes = std::vector<std::unique_ptr<Node>> {};
+        while (auto* node = pop()) {
+            nodes.emplace_back(node);
+        }
+        pending_.fetch_sub(nodes.size(), std::memory_order_relaxed);
+
+        // latest-value-wins: only the last write per control and accessor
+        auto seen = std::set<std::pair<void const*, void const*>> {};
+        for (auto i = nodes.size(); i-- > 0;) {
+            if (nodes[i]->latest && nodes[i]->accessor != nullptr && !seen.emplace(nodes[i]->control, nodes[i]->accessor).second) {
+                nodes[i].reset();
+            }
+        }
+        for (auto& node : nodes) {
+            if (node && (node->alive.check == nullptr || node->alive.check(node->alive.attachment.get(), node->control))) {
+                node->write();
+            }
+        }
+        return pending_.load(std::memory_order_relaxed) > 0 && !armed_.exchange(true, std::memory_order_acq_rel);
+    }
+
+private:
+    struct Node {
+        std::atomic<Node*> next;
+        void const* control;
+        void const* accessor;
+        bool latest;
+        std::function<void()> write;
+        Alive alive;
+    };
+
+    void link(Node* node)
+    {
+        node->next.store(nullptr, std::memory_order_relaxed);
+        auto* previous = head_.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_release);
+    }
+
+    // Returns nullptr when empty, or when a producer is half way through
+    // link(); that producer's write is picked up by the next drain.
+    auto pop() -> Node*
+    {
+        auto* tail = tail_;
+        auto* next = tail->next.load(std::memory_order_acquire);
+        if (tail == &stub_) {
+            if (next == nullptr) {
+                return nullptr;
+            }
+            tail_ = next;
+            tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+        if (next != nullptr) {
+            tail_ = next;
+            return tail;
+        }
+        if (tail != head_.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        link(&stub_);
+        next = tail->next.load(std::memory_order_acquire);
+        if (next != nullptr) {
+            tail_ = next;
+            return tail;
+        }
+        return nullptr;
+    }
+
+    Node stub_ {};
+    std::atomic<Node*> head_;
+    Node* tail_;
+    std::atomic<std::size_t> pending_ { 0 };
+    std::atomic<bool> armed_ { false };
+};
+
+}
@@ -0,0 +1,125 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+
+#include <any>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <wxUI/Customizations.hpp>
+#include <wxUI/Proxy.hpp>
+
+namespace wxUI::details {
+
+// What a Prototype measures once and shares between the copies it stamps out:
+// the best sizes of the controllers of the first copy, in the order they were
+// created.
+struct PrototypeCache {
+    std::vector<wxSize> bestSizes {};
+    bool reuseBestSizes = false;
+    bool measured = false;
+};
+
+// A proxy of the prototype and the proxy that stands in for it in one copy.
+struct ProxyRedirect {
+    void const* prototype;
+    std::any proxy;
+};
+
+// While a PrototypeScope is alive, the controls and sizers created on this
+// thread make up one copy stamped out by a Prototype.
+class PrototypeScope {
+public:
+    PrototypeScope(PrototypeCache& cache, std::vector<ProxyRedirect>& redirects)
+        : cache_(cache)
+        , redirects_(redirects)
+        , previous_(std::exchange(currentSlot(), this))
+    {
+    }
+    ~PrototypeScope() { currentSlot() = previous_; }
+    PrototypeScope(PrototypeScope const&) = delete;
+    PrototypeScope(PrototypeScope&&) = delete;
+    auto operator=(PrototypeScope const&) -> PrototypeScope& = delete;
+    auto operator=(PrototypeScope&&) -> PrototypeScope& = delete;
+
+    // The proxy to attach in place of `proxy`: the copy's own if it was given
+    // one, by the innermost copy being created that has one, otherwise
+    // `proxy` itself.
+    template <typename Underlying>
+    static auto proxyFor(Proxy<Underlying>& proxy) -> Proxy<Underlying>&
+    {
+        for (auto* scope = currentSlot(); scope != nullptr; scope = scope->previous_) {
+            for (auto& redirect : scope->redirects_) {
+                if (redirect.prototype == proxy.identity()) {
+                    return *std::any_cast<Proxy<Underlying>>(&redirect.proxy);
+                }
+            }
+        }
+        return proxy;
+    }
+
+    // Called with each control once it is set up.  The first copy records its
+    // best size, and later copies take the recorded size as their minimum.
+    template <typename Controller>
+    static void created(Controller* controller)
+    {
+        auto* scope = currentSlot();
+        if (scope == nullptr || !scope->cache_.reuseBestSizes) {
+            return;
+        }
+        auto& cache = scope->cache_;
+        if (!cache.measured) {
+            using ::wxUI::customizations::ControllerBestSize;
+            cache.bestSizes.push_back(ControllerBestSize(controller));
+        } else if (scope->next_ < cache.bestSizes.size()) {
+            auto size = cache.bestSizes[scope->next_++];
+            if (size != wxDefaultSize) {
+                using ::wxUI::customizations::ControllerSetMinSize;
+                ControllerSetMinSize(controller, size);
+            }
+        }
+    }
+
+    // The copy was created in full, so what the first one measured is complete.
+    void finish()
+    {
+        if (cache_.reuseBestSizes) {
+            cache_.measured = true;
+        }
+    }
+
+private:
+    static auto currentSlot() -> PrototypeScope*&
+    {
+        thread_local PrototypeScope* current = nullptr;
+        return current;
+    }
+
+    PrototypeCache& cache_;
+    std::vector<ProxyRedirect>& redirects_;
+    PrototypeScope* previous_;
+    std::size_t next_ = 0;
+};
+
+}
@@ -0,0 +1,92 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace wxUI::details {
+
+// Sampler runs the UI side of the objects that let worker threads feed
+// controls cheaply (ProgressReporter, TextLog) from one shared timer.  It is
+// only touched on the UI thread; the timer runs while there is something
+// to sample and stops itself afterwards.
+class Sampler {
+public:
+    static constexpr auto kDefaultInterval = std::chrono::milliseconds { 1000 / 30 };
+
+    static auto instance() -> Sampler&
+    {
+        static auto sampler = Sampler {};
+        return sampler;
+    }
+
+    [[nodiscard]] auto interval() const { return interval_; }
+    void setInterval(std::chrono::milliseconds interval) { interval_ = interval; }
+
+    // `sample` is called on every tick until it returns false.  `startTimer`
+    // starts the timer from the control `sample` feeds; it is called when
+    // there is no timer running.
+    void add(std::function<bool()> sample, std::function<void()> startTimer)
+    {
+        samples_.push_back({ std::move(sample), std::move(startTimer) });
+        if (!std::exchange(running_, true)) {
+            samples_.back().startTimer();
+        }
+    }
+
+    // Called by the timer.  Returns false once there is nothing left to
+    // sample, at which point the timer should stop.
+    auto tick() -> bool
+    {
+        std::erase_if(samples_, [](auto& entry) { return !entry.sample(); });
+        running_ = !samples_.empty();
+        return running_;
+    }
+
+    // Called when the timer is destroyed while tick() still wanted it, for
+    // instance with the window it belonged to, once that window is gone.
+    // The samples of controls that went with it are dropped, and the rest
+    // get a new timer from one of theirs.
+    void timerStopped()
+    {
+        if (tick()) {
+            samples_.front().startTimer();
+        }
+    }
+
+private:
+    struct Entry {
+        std::function<bool()> sample;
+        std::function<void()> startTimer;
+    };
+
+    std::vector<Entry> samples_;
+    std::chrono::milliseconds interval_ { kDefaultInterval };
+    bool running_ {};
+};
+
+}
@@ -0,0 +1,168 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace wxUI::details {
+
+// The base of the interfaces SmallStorage holds, which SmallStorage
+// implements for each type it stores.
+template <typename Interface>
+struct Storable {
+    Storable() = default;
+    Storable(Storable const&) = default;
+    Storable(Storable&&) = default;
+    auto operator=(Storable const&) -> Storable& = default;
+    auto operator=(Storable&&) -> Storable& = default;
+    virtual ~Storable() = default;
+    // Construct a copy of this in `storage`, or on the heap if it is held
+    // there.
+    [[nodiscard]] virtual auto cloneInto(void* storage) const -> Interface* = 0;
+    // Move this into `storage`, leaving nothing behind to destroy.  Objects
+    // held on the heap are not moved; their pointer is returned.
+    [[nodiscard]] virtual auto moveInto(void* storage) noexcept -> Interface* = 0;
+    virtual void destroy() noexcept = 0;
+};
+
+// SmallStorage holds one object implementing Interface, with its type
+// erased.  Types that fit in InlineSize bytes and move without throwing are
+// stored inline, so holding, copying and moving them does not allocate;
+// larger ones are kept on the heap.  Interface derives from
+// Storable<Interface>.
+template <typename Interface, std::size_t InlineSize>
+class SmallStorage {
+public:
+    template <typename Type>
+    static constexpr auto fitsInline() -> bool
+    {
+        return sizeof(Inline<Type>) <= InlineSize && alignof(Inline<Type>) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<Inline<Type>>;
+    }
+
+    template <typename Type, typename... Args>
+    explicit SmallStorage(std::in_place_type_t<Type>, Args&&... args)
+    {
+        static_assert(std::is_base_of_v<Interface, Type>);
+        if constexpr (fitsInline<Type>()) {
+            object_ = new (&storage_) Inline<Type>(std::forward<Args>(args)...);
+        } else {
+            object_ = new Heap<Type>(std::forward<Args>(args)...);
+        }
+    }
+
+    ~SmallStorage()
+    {
+        reset();
+    }
+
+    SmallStorage(SmallStorage const& other)
+        : object_(other.object_ ? other.object_->cloneInto(&storage_) : nullptr)
+    {
+    }
+
+    auto operator=(SmallStorage const& other) -> SmallStorage&
+    {
+        if (this == &other) {
+            return *this;
+        }
+        return *this = SmallStorage { other };
+    }
+
+    SmallStorage(SmallStorage&& other) noexcept
+        : object_(other.object_ ? std::exchange(other.object_, nullptr)->moveInto(&storage_) : nullptr)
+    {
+    }
+
+    auto operator=(SmallStorage&& other) noexcept -> SmallStorage&
+    {
+        if (this == &other) {
+            return *this;
+        }
+        reset();
+        object_ = other.object_ ? std::exchange(other.object_, nullptr)->moveInto(&storage_) : nullptr;
+        return *this;
+    }
+
+    auto operator->() const -> Interface* { return object_; }
+
+private:
+    template <typename Type>
+    struct Inline final : Type {
+        template <typename... Args>
+        explicit Inline(Args&&... args)
+            : Type(std::forward<Args>(args)...)
+        {
+        }
+        [[nodiscard]] auto cloneInto(void* storage) const -> Interface* override
+        {
+            return new (storage) Inline(static_cast<Type const&>(*this));
+        }
+        [[nodiscard]] auto moveInto(void* storage) noexcept -> Interface* override
+        {
+            auto* moved = new (storage) Inline(std::move(static_cast<Type&>(*this)));
+            this->~Inline();
+            return moved;
+        }
+        void destroy() noexcept override
+        {
+            this->~Inline();
+        }
+    };
+
+    template <typename Type>
+    struct Heap final : Type {
+        template <typename... Args>
+        explicit Heap(Args&&... args)
+            : Type(std::forward<Args>(args)...)
+        {
+        }
+        [[nodiscard]] auto cloneInto(void*) const -> Interface* override
+        {
+            return new Heap(static_cast<Type const&>(*this));
+        }
+        [[nodiscard]] auto moveInto(void*) noexcept -> Interface* override
+        {
+            return this;
+        }
+        void destroy() noexcept override
+        {
+            delete this;
+        }
+    };
+
+    void reset() noexcept
+    {
+        if (object_) {
+            std::exchange(object_, nullptr)->destroy();
+        }
+    }
+
+    alignas(std::max_align_t) std::byte storage_[InlineSize];
+    Interface* object_ {};
+};
+
+}
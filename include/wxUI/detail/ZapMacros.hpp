@@ -46,6 +46,10 @@ SOFTWARE.
 #undef WXUI_FORWARD_TO_DETAILS
 #endif
 
+#if defined(WXUI_FORWARD_NOARG_TO_DETAILS)
+#undef WXUI_FORWARD_NOARG_TO_DETAILS
+#endif
+
 #if defined(WXUI_FORWARD_BIND_TO_DETAILS)
 #undef WXUI_FORWARD_BIND_TO_DETAILS
 #endif
@@ -31,6 +31,7 @@
 
 #include <wxUI/Bitmap.hpp>
 #include <wxUI/BitmapButton.hpp>
+#include <wxUI/BitmapCache.hpp>
 #include <wxUI/BitmapComboBox.hpp>
 #include <wxUI/BitmapToggleButton.hpp>
 #include <wxUI/BookCtrl.hpp>
@@ -38,10 +39,12 @@
 #include <wxUI/CalendarCtrl.hpp>
 #include <wxUI/CheckBox.hpp>
 #include <wxUI/Choice.hpp>
+#include <wxUI/ChoiceList.hpp>
 #include <wxUI/ColorPickerCtrl.hpp>
 #include <wxUI/ComboBox.hpp>
 #include <wxUI/Custom.hpp>
 #include <wxUI/Customizations.hpp>
+#include <wxUI/DynamicSizer.hpp>
 #include <wxUI/Factory.hpp>
 #include <wxUI/ForEach.hpp>
 #include <wxUI/Gauge.hpp>
@@ -49,9 +52,13 @@
 #include <wxUI/Hyperlink.hpp>
 #include <wxUI/Layout.hpp>
 #include <wxUI/LayoutIf.hpp>
+#include <wxUI/LayoutImage.hpp>
 #include <wxUI/Line.hpp>
 #include <wxUI/ListBox.hpp>
+#include <wxUI/Literal.hpp>
 #include <wxUI/Menu.hpp>
+#include <wxUI/ProgressReporter.hpp>
+#include <wxUI/Prototype.hpp>
 #include <wxUI/Proxy.hpp>
 #include <wxUI/RadioBox.hpp>
 #include <wxUI/Slider.hpp>
@@ -59,5 +66,9 @@
 #include <wxUI/Splitter.hpp>
 #include <wxUI/Text.hpp>
 #include <wxUI/TextCtrl.hpp>
+#include <wxUI/TextExtentCache.hpp>
+#include <wxUI/TextLog.hpp>
+#include <wxUI/Transaction.hpp>
+#include <wxUI/VirtualListBox.hpp>
 #include <wxUI/Widget.hpp>
 #include <wxUI/wxUITypes.hpp>
@@ -0,0 +1,146 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// The wxUI module, for `import wxUI;` instead of including wxUI/wxUI.hpp.
+//
+// The module is built from the headers themselves: they are included in the
+// global module fragment and the public names re-exported below, so the
+// module and the headers can never disagree.  wxWidgets is not exported;
+// include the wx headers you use as before.
+//
+// Customizations are a textual opt-in.  wxUI finds its customization points
+// where its templates are defined, which for the module is here, so
+// overloads in wxUI::customizations are only seen if they are part of the
+// module.  A header of them named by WXUI_MODULE_CUSTOMIZATIONS is included
+// first, as a translation unit using the headers would include it.
+//
+// The deprecated Generic and Wrapper are not exported; use Factory.
+
+module;
+
+#ifdef WXUI_MODULE_CUSTOMIZATIONS
+#include WXUI_MODULE_CUSTOMIZATIONS
+#endif
+#include <wxUI/wxUI.hpp>
+
+export module wxUI;
+
+export namespace wxUI {
+
+// Controllers
+using wxUI::Bitmap;
+using wxUI::BitmapButton;
+using wxUI::BitmapComboBox;
+using wxUI::BitmapToggleButton;
+using wxUI::Button;
+using wxUI::CalendarCtrl;
+using wxUI::CheckBox;
+using wxUI::Choice;
+using wxUI::ColorPickerCtrl;
+using wxUI::ComboBox;
+using wxUI::Custom;
+using wxUI::Factory;
+using wxUI::FactoryProxy;
+using wxUI::Gauge;
+using wxUI::HLine;
+using wxUI::Hyperlink;
+using wxUI::Line;
+using wxUI::ListBox;
+using wxUI::RadioBox;
+using wxUI::Slider;
+using wxUI::SpinCtrl;
+using wxUI::Text;
+using wxUI::TextCtrl;
+using wxUI::VirtualListBox;
+
+// Layout
+using wxUI::BookItem;
+using wxUI::Choicebook;
+using wxUI::DynamicHSizer;
+using wxUI::DynamicVSizer;
+using wxUI::FlexGridSizer;
+using wxUI::ForEach;
+using wxUI::GridSizer;
+using wxUI::HForEach;
+using wxUI::HSizer;
+using wxUI::HSplitter;
+using wxUI::HWrapSizer;
+using wxUI::KeyedForEach;
+using wxUI::KeyedForEachProxy;
+using wxUI::LayoutIf;
+using wxUI::LayoutImage;
+using wxUI::Listbook;
+using wxUI::MappedLayout;
+using wxUI::Notebook;
+using wxUI::Prototype;
+using wxUI::Simplebook;
+using wxUI::SizerProxy;
+using wxUI::Spacer;
+using wxUI::SplitterProxy;
+using wxUI::StretchSpacer;
+using wxUI::Treebook;
+using wxUI::VForEach;
+using wxUI::VSizer;
+using wxUI::VSplitter;
+using wxUI::VWrapSizer;
+
+// Menus
+using wxUI::CheckItem;
+using wxUI::Item;
+using wxUI::Menu;
+using wxUI::MenuBar;
+using wxUI::MenuBarProxy;
+using wxUI::MenuForEach;
+using wxUI::MenuItemProxy;
+using wxUI::MenuProxy;
+using wxUI::RadioItem;
+using wxUI::Separator;
+
+// Values and updates
+using wxUI::ChoiceList;
+using wxUI::ChoicesUpdate;
+using wxUI::post;
+using wxUI::Posted;
+using wxUI::postLatest;
+using wxUI::ProgressReporter;
+using wxUI::TextLog;
+using wxUI::Transaction;
+
+// Caches
+using wxUI::BitmapCache;
+using wxUI::TextExtentCache;
+
+// Strings
+using wxUI::literal;
+using wxUI::Literal;
+using wxUI::wxUI_String;
+
+inline namespace literals {
+    using wxUI::literals::operator""_wx;
+}
+
+using wxUI::Version;
+using wxUI::version;
+
+}
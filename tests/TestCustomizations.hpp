@@ -23,14 +23,21 @@ SOFTWARE.
 */
 #pragma once
 
+#include <algorithm>
+#include <chrono>
 #include <format>
+#include <functional>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <ostream>
 #include <string>
+#include <type_traits>
+#include <utility>
 #include <variant>
 #include <vector>
+#include <wx/bmpbndl.h>
 #include <wx/bmpbuttn.h>
 #include <wx/bmpcbox.h>
 #include <wx/checkbox.h>
@@ -67,6 +74,7 @@ namespace wxUI::details {
 struct BindInfo;
 template <typename T>
 struct Proxy;
+class VirtualListBoxCtrl;
 }
 
 // helpful formatters
@@ -99,6 +107,19 @@ struct std::formatter<wxBitmap, char> {
     }
 };
 
+template <>
+struct std::formatter<wxBitmapBundle, char> {
+    constexpr auto parse(std::format_parse_context& ctx) { return ctx.begin(); }
+    auto format(wxBitmapBundle const& bitmap, std::format_context& ctx) const
+    {
+        if (bitmap.IsOk()) {
+            return std::format_to(ctx.out(), "{}", bitmap.GetDefaultSize());
+        } else {
+            return std::format_to(ctx.out(), "(-1,-1)");
+        }
+    }
+};
+
 template <>
 struct std::formatter<wxSizerFlags, char> {
     constexpr auto parse(std::format_parse_context& ctx) { return ctx.begin(); }
@@ -265,6 +286,37 @@ struct MenuItemTypeFor<wxUITests::TestParent> {
 
 namespace wxUITests {
 
+inline auto postWakes() -> std::vector<std::function<void()>>&
+{
+    static auto wakes = std::vector<std::function<void()>> {};
+    return wakes;
+}
+
+inline auto postWakesMutex() -> std::mutex&
+{
+    static auto mutex = std::mutex {};
+    return mutex;
+}
+
+struct TestTimer {
+    std::chrono::milliseconds interval;
+    std::function<bool()> tick;
+    std::function<void()> stopped;
+};
+
+inline auto samplerTimers() -> std::vector<TestTimer>&
+{
+    static auto timers = std::vector<TestTimer> {};
+    return timers;
+}
+
+// The identity of every proxy bound to a control or sizer.
+inline auto boundProxies() -> std::vector<void const*>&
+{
+    static auto proxies = std::vector<void const*> {};
+    return proxies;
+}
+
 struct TestSizer {
     bool top { false };
     SizerType type { SizerType::Box };
@@ -278,6 +330,15 @@ struct TestSizer {
     void AddSpacer(int size);
     void AddStretchSpacer(int proportion);
     std::vector<std::string> log {};
+    std::vector<std::string> children {};
+    // Stand in for wxSizerItem*, following the children as they move.
+    std::vector<std::shared_ptr<int const>> childHandles {};
+
+    void addChild(std::string child)
+    {
+        children.push_back(std::move(child));
+        childHandles.push_back(std::make_shared<int const>());
+    }
 };
 
 struct TestParent {
@@ -288,17 +349,28 @@ struct TestParent {
     int64_t style {};
     std::optional<std::string> text {};
     std::optional<std::string> text2 {};
-    std::optional<wxBitmap> bitmap {};
+    std::optional<wxBitmapBundle> bitmap {};
     std::optional<std::vector<std::string>> choices {};
     std::optional<int> value {};
     std::optional<wxCheckBoxState> value3State {};
     std::optional<wxColour> color {};
     std::optional<std::pair<int, int>> range {};
     std::optional<int> majorDim {};
+    std::optional<size_t> count {};
+    std::function<wxString(size_t)> rowText {};
+    std::optional<double> dpiScale {};
+    wxString fontDescription { "Sans 9" };
+    std::optional<wxSize> itemBitmapSize {};
 
     std::vector<std::string> log {};
     std::vector<std::string> menuDetails {};
     std::vector<std::string> bookPages {};
+    std::vector<std::function<void()>> lazyPages {};
+    std::vector<std::function<void()>> dropDowns {};
+    std::function<bool(int)> dispatchMenu {};
+    std::function<bool(wxEventType, TestParent const*, wxEvent&)> dispatchEvent {};
+    std::vector<std::function<void()>> destroyHandlers {};
+    std::vector<std::function<void(TestParent const*)>> childDestroyHandlers {};
     std::list<TestParent> parents {};
     std::list<TestSizer> sizers {};
     std::list<TestMenu> menus {}; // Storage for mock menus
@@ -306,6 +378,20 @@ struct TestParent {
 
     TestSizer* currentSizer {};
     TestParent* currentMenu {};
+    TestParent* parentWindow {};
+    // Stands in for wxEVT_DESTROY, which as a command event reaches the
+    // parents too.
+    void destroy()
+    {
+        for (auto& handler : std::exchange(destroyHandlers, {})) {
+            handler();
+        }
+        for (auto* parent = parentWindow; parent != nullptr; parent = parent->parentWindow) {
+            for (auto& handler : parent->childDestroyHandlers) {
+                handler(this);
+            }
+        }
+    }
     void SetSizer(TestSizer* sizer) { currentSizer = sizer; }
     void SetSashGravity(double gravity)
     {
@@ -322,11 +408,36 @@ struct TestParent {
     void SetItemBitmap(unsigned int n, Bitmap const& bitmap)
     {
         log.push_back(std::format("SetItemBitmap:{}:{}", n, bitmap));
+        // like wxBitmapComboBox, the items are sized from the first bitmap
+        if (!itemBitmapSize && bitmap.IsOk()) {
+            if constexpr (std::is_same_v<Bitmap, wxBitmapBundle>) {
+                itemBitmapSize = bitmap.GetDefaultSize();
+            } else {
+                itemBitmapSize = bitmap.GetSize();
+            }
+        }
     }
     void SetSelection(int selection)
     {
         log.push_back(std::format("SetSelection:{}", selection));
     }
+    auto GetCount() const -> unsigned int
+    {
+        return static_cast<unsigned int>(choices ? choices->size() : 0);
+    }
+    auto GetString(unsigned int n) const -> wxString
+    {
+        return wxString::FromUTF8(choices.value().at(n));
+    }
+    void Select(size_t selection)
+    {
+        log.push_back(std::format("Select:{}", selection));
+    }
+    // As wxVListBox, which only has a selection store with wxLB_MULTIPLE.
+    auto HasMultipleSelection() const -> bool
+    {
+        return (style & wxLB_MULTIPLE) != 0;
+    }
     void SetValue(bool value)
     {
         log.push_back(std::format("SetValue:{}", value));
@@ -358,6 +469,37 @@ struct TestParent {
     void SetSizerAndFit(TestSizer* sizer);
     void AddPage(TestParent* page, wxString const& title, bool select);
 
+    // Enough of wxTextCtrl for the TextCtrl::Proxy accessors, kept in `text`.
+    auto GetLastPosition() const -> long { return static_cast<long>(text.value_or("").size()); }
+    auto GetNumberOfLines() const -> int { return static_cast<int>(std::ranges::count(text.value_or(""), '\n')) + 1; }
+    auto GetRange(long from, long to) const -> wxString
+    {
+        return wxString::FromUTF8(text.value_or("").substr(static_cast<size_t>(from), static_cast<size_t>(to - from)));
+    }
+    auto GetLineText(long lineNumber) const -> wxString
+    {
+        auto contents = text.value_or("");
+        auto start = size_t {};
+        for (; lineNumber > 0 && start != std::string::npos; --lineNumber) {
+            start = contents.find('\n', start);
+            start = start == std::string::npos ? start : start + 1;
+        }
+        if (start == std::string::npos) {
+            return {};
+        }
+        return wxString::FromUTF8(contents.substr(start, contents.find('\n', start) - start));
+    }
+    void Replace(long from, long to, wxString const& value)
+    {
+        log.push_back(std::format("Replace:{}:{}:{}", from, to, value.utf8_string()));
+        text = text.value_or("").replace(static_cast<size_t>(from), static_cast<size_t>(to - from), value.utf8_string());
+    }
+    void AppendText(wxString const& value)
+    {
+        log.push_back(std::format("AppendText:{}", value.utf8_string()));
+        text = text.value_or("") + value.utf8_string();
+    }
+
     auto add(TestParent controller) -> TestParent*;
     auto add(TestSizer controller) -> TestSizer*;
     auto dump() const -> std::vector<std::string>;
@@ -405,6 +547,9 @@ struct std::formatter<wxUITests::TestParent, char> {
         if (c.majorDim.has_value()) {
             std::format_to(ctx.out(), ", majorDim={}", *c.majorDim);
         }
+        if (c.count.has_value()) {
+            std::format_to(ctx.out(), ", count={}", *c.count);
+        }
         return std::format_to(ctx.out(), "]");
     }
 };
@@ -447,6 +592,7 @@ namespace wxUITests {
 inline auto TestParent::add(TestParent controller) -> TestParent*
 {
     parents.push_back(controller);
+    parents.back().parentWindow = this;
     log.push_back(std::format("Create:{}", controller));
     return &parents.back();
 }
@@ -517,21 +663,25 @@ inline void TestSizer::SetSizeHints(TestParent* controller)
 inline void TestSizer::Add(TestParent* controller, wxSizerFlags const& flags)
 {
     log.push_back(std::format("Add:{}:flags:{}", *controller, flags));
+    addChild(std::format("{}", *controller));
 }
 
 inline void TestSizer::Add(TestSizer* sizer, wxSizerFlags const& flags)
 {
     log.push_back(std::format("AddSizer:{}:flags:{}", *sizer, flags));
+    addChild(std::format("{}", *sizer));
 }
 
 inline void TestSizer::AddSpacer(int size)
 {
     log.push_back(std::format("AddSpacer:{}", size));
+    addChild(std::format("Spacer:{}", size));
 }
 
 inline void TestSizer::AddStretchSpacer(int proportion)
 {
     log.push_back(std::format("AddStretchSpacer:{}", proportion));
+    addChild(std::format("StretchSpacer:{}", proportion));
 }
 
 }
@@ -544,7 +694,7 @@ struct ParentCreateImpl;
 
 template <>
 struct ParentCreateImpl<wxStaticBitmap, wxUITests::TestParent> {
-    static auto create(wxUITests::TestParent* parent, wxWindowID id, wxBitmap bitmap, wxPoint pos, wxSize size, int64_t style)
+    static auto create(wxUITests::TestParent* parent, wxWindowID id, wxBitmapBundle const& bitmap, wxPoint pos, wxSize size, int64_t style)
     {
         return parent->add({
             .type = "wxStaticBitmap",
@@ -559,7 +709,7 @@ struct ParentCreateImpl<wxStaticBitmap, wxUITests::TestParent> {
 
 template <>
 struct ParentCreateImpl<wxBitmapButton, wxUITests::TestParent> {
-    static auto create(wxUITests::TestParent* parent, wxWindowID id, wxBitmap bitmap, wxPoint pos, wxSize size, int64_t style)
+    static auto create(wxUITests::TestParent* parent, wxWindowID id, wxBitmapBundle const& bitmap, wxPoint pos, wxSize size, int64_t style)
     {
         return parent->add({
             .type = "wxBitmapButton",
@@ -594,7 +744,7 @@ struct ParentCreateImpl<wxBitmapComboBox, wxUITests::TestParent> {
 
 template <>
 struct ParentCreateImpl<wxBitmapToggleButton, wxUITests::TestParent> {
-    static auto create(wxUITests::TestParent* parent, wxWindowID id, wxBitmap bitmap, wxPoint pos, wxSize size, int64_t style)
+    static auto create(wxUITests::TestParent* parent, wxWindowID id, wxBitmapBundle const& bitmap, wxPoint pos, wxSize size, int64_t style)
     {
         return parent->add({
             .type = "wxBitmapToggleButton",
@@ -755,6 +905,22 @@ struct ParentCreateImpl<wxListBox, wxUITests::TestParent> {
     }
 };
 
+template <>
+struct ParentCreateImpl<wxUI::details::VirtualListBoxCtrl, wxUITests::TestParent> {
+    static auto create(wxUITests::TestParent* parent, wxWindowID id, wxPoint pos, wxSize size, int64_t style, size_t count, std::function<wxString(size_t)> const& generator)
+    {
+        return parent->add({
+            .type = "wxVListBox",
+            .id = id,
+            .pos = pos,
+            .size = size,
+            .style = style,
+            .count = count,
+            .rowText = generator,
+        });
+    }
+};
+
 template <>
 struct ParentCreateImpl<wxRadioBox, wxUITests::TestParent> {
     static auto create(wxUITests::TestParent* parent, wxWindowID id, wxString const& text, wxPoint pos, wxSize size, int n, const wxString* choices, int majorDim, int64_t style)
@@ -942,18 +1108,188 @@ inline void ControllerBindEvent(wxUITests::TestParent* controller, wxUI::details
     controller->log.push_back(std::format("BindEvents:{}", count + 1));
 }
 
+template <typename Dispatcher, typename BoundFunction>
+inline void ControllerDispatchEvent(wxUITests::TestParent* controller, Dispatcher& dispatcher, BoundFunction const& boundedFunction)
+{
+    if (!boundedFunction.addTo(dispatcher, controller->id, controller)) {
+        ControllerBindEvent(controller, boundedFunction);
+        return;
+    }
+    auto count = std::ranges::count_if(controller->log, [](auto const& e) { return e.starts_with("DispatchEvents:"); });
+    controller->log.push_back(std::format("DispatchEvents:{}", count + 1));
+}
+
+template <typename Dispatcher>
+inline void ContainerBindDispatcher(wxUITests::TestParent* parent, std::shared_ptr<Dispatcher> dispatcher)
+{
+    parent->log.push_back(std::format("BindDispatcher:{}", dispatcher->eventTypes().size()));
+    parent->childDestroyHandlers.push_back([dispatcher](wxUITests::TestParent const* child) {
+        dispatcher->remove(child);
+    });
+    parent->dispatchEvent = [dispatcher = std::move(dispatcher)](wxEventType type, wxUITests::TestParent const* source, wxEvent& event) {
+        return dispatcher->dispatch(type, source->id, source, event);
+    };
+}
+
 template <typename Proxy>
-inline void ControllerBindProxy(wxUITests::TestParent* controller, Proxy&)
+inline void ControllerBindProxy(wxUITests::TestParent* controller, Proxy& proxyHandle)
 {
     auto count = std::ranges::count_if(controller->log, [](auto const& e) { return e.starts_with("BindProxy:"); });
     controller->log.push_back(std::format("BindProxy:{}", count + 1));
+    if constexpr (requires { proxyHandle.identity(); }) {
+        wxUITests::boundProxies().push_back(proxyHandle.identity());
+    }
+}
+
+// A stand-in for measuring the control: wide enough for its text.
+inline auto ControllerBestSize(wxUITests::TestParent* controller) -> wxSize
+{
+    controller->log.push_back("GetBestSize");
+    return { static_cast<int>(controller->text.value_or("").size()) * 8, 20 };
+}
+
+inline void ControllerSetMinSize(wxUITests::TestParent* controller, wxSize size)
+{
+    controller->log.push_back(std::format("SetMinSize:{}", size));
+}
+
+// Labels are only measured in parents given a DPI scale, so that other tests
+// see their controllers made as they always were.
+inline auto ParentTextExtentContext(wxUITests::TestParent* parent) -> std::optional<TextExtentContext>
+{
+    if (!parent->dpiScale) {
+        return std::nullopt;
+    }
+    return TextExtentContext { {}, parent->fontDescription, *parent->dpiScale };
+}
+
+inline auto ControllerTextExtent(wxUITests::TestParent* controller, TextExtentContext const&) -> std::optional<TextExtent>
+{
+    return TextExtent { wxString::FromUTF8(controller->text.value_or("")), ControllerBestSize(controller) };
+}
+
+inline auto ControllerUseTextExtent(wxUITests::TestParent* controller, TextExtentContext const&, TextExtent const& extent, wxString const&) -> bool
+{
+    controller->log.push_back(std::format("UseTextExtent:{}", extent.bestSize));
+    return true;
 }
 
 template <typename Proxy>
-inline void SizerBindProxy(wxUITests::TestSizer* controller, Proxy&)
+inline void SizerBindProxy(wxUITests::TestSizer* controller, Proxy& proxyHandle)
 {
     auto count = std::ranges::count_if(controller->log, [](auto const& e) { return e.starts_with("SizerBindProxy:"); });
     controller->log.push_back(std::format("SizerBindProxy:{}", count + 1));
+    if constexpr (requires { proxyHandle.identity(); }) {
+        wxUITests::boundProxies().push_back(proxyHandle.identity());
+    }
+}
+
+inline void ControllerBindDropDown(wxUITests::TestParent* controller, std::function<void()> populate)
+{
+    controller->log.push_back("BindDropDown");
+    controller->dropDowns.push_back(std::move(populate));
+}
+
+inline void BookBindLazyPage(wxUITests::TestParent* book, wxUITests::TestParent* page, std::function<void()> realize)
+{
+    book->log.push_back(std::format("BindLazyPage:{}", *page));
+    book->lazyPages.push_back(std::move(realize));
+}
+
+inline auto SizerItemCount(wxUITests::TestSizer* sizer) -> size_t
+{
+    return sizer->children.size();
+}
+
+inline void SizerRemoveItem(wxUITests::TestSizer* sizer, size_t index)
+{
+    sizer->log.push_back(std::format("Remove:{}", index));
+    sizer->children.erase(sizer->children.begin() + static_cast<std::ptrdiff_t>(index));
+    sizer->childHandles.erase(sizer->childHandles.begin() + static_cast<std::ptrdiff_t>(index));
+}
+
+inline void SizerMoveItem(wxUITests::TestSizer* sizer, size_t from, size_t to)
+{
+    sizer->log.push_back(std::format("Move:{}:{}", from, to));
+    auto child = std::move(sizer->children[from]);
+    sizer->children.erase(sizer->children.begin() + static_cast<std::ptrdiff_t>(from));
+    sizer->children.insert(sizer->children.begin() + static_cast<std::ptrdiff_t>(to), std::move(child));
+    auto handle = std::move(sizer->childHandles[from]);
+    sizer->childHandles.erase(sizer->childHandles.begin() + static_cast<std::ptrdiff_t>(from));
+    sizer->childHandles.insert(sizer->childHandles.begin() + static_cast<std::ptrdiff_t>(to), std::move(handle));
+}
+
+inline auto SizerItemHandle(wxUITests::TestSizer* sizer, size_t index) -> void const*
+{
+    return sizer->childHandles[index].get();
+}
+
+inline auto SizerItemIndex(wxUITests::TestSizer* sizer, void const* handle) -> size_t
+{
+    return static_cast<size_t>(std::ranges::find(sizer->childHandles, handle, &std::shared_ptr<int const>::get) - sizer->childHandles.begin());
+}
+
+inline void WindowBindDestroy(wxUITests::TestParent* window, std::function<void()> destroyed)
+{
+    window->destroyHandlers.push_back(std::move(destroyed));
+}
+
+inline void SizerUpdate(wxUITests::TestParent* parent, wxUITests::TestSizer* sizer, std::function<void()> const& changes)
+{
+    sizer->log.push_back("BeginUpdate");
+    changes();
+    sizer->log.push_back("EndUpdate");
+    parent->log.push_back("Layout");
+}
+
+// Stands in for the event loop: wake-ups requested by wxUI::post are kept
+// here for the test to run.
+inline void ProxyPostWake(wxUITests::TestParent*, std::function<void()> drain)
+{
+    auto lock = std::scoped_lock { wxUITests::postWakesMutex() };
+    wxUITests::postWakes().push_back(std::move(drain));
+}
+
+// Timers started by details::Sampler are kept here for the test to tick.
+inline void SamplerTimerStart(wxUITests::TestParent*, std::chrono::milliseconds interval, std::function<bool()> tick, std::function<void()> stopped)
+{
+    wxUITests::samplerTimers().push_back({ interval, std::move(tick), std::move(stopped) });
+}
+
+inline void TextLogUpdate(wxUITests::TestParent* controller, long removeLines, wxString const& text)
+{
+    if (removeLines > 0) {
+        controller->log.push_back(std::format("RemoveLines:{}", removeLines));
+        auto current = controller->text.value_or("");
+        auto cut = std::string::size_type {};
+        for (auto line = 0L; line < removeLines && cut != std::string::npos; ++line) {
+            cut = current.find('\n', cut);
+            cut = cut == std::string::npos ? cut : cut + 1;
+        }
+        controller->text = cut == std::string::npos ? std::string {} : current.substr(cut);
+    }
+    controller->log.push_back(std::format("AppendText:{}", text.utf8_string()));
+    controller->text = controller->text.value_or("") + text.utf8_string();
+}
+
+// Like wxWindowUpdateLocker, thaws the window even if a change throws.
+inline void WindowUpdate(wxUITests::TestParent* window, std::function<void()> const& changes)
+{
+    {
+        window->log.push_back("Freeze");
+        struct Thaw {
+            ~Thaw() { window->log.push_back("Thaw"); }
+            wxUITests::TestParent* window;
+        } thaw { window };
+        changes();
+        window->log.push_back("Layout");
+    }
+    window->log.push_back("Refresh");
+}
+
+inline auto WindowParent(wxUITests::TestParent* window) -> wxUITests::TestParent*
+{
+    return window->parentWindow;
 }
 
 inline auto SizerCreate(wxUITests::TestParent* parent, SizerInfo const& info) -> wxUITests::TestSizer*
@@ -1093,6 +1429,16 @@ inline void MenuBindToFrame(wxUITests::TestParent& frame, int identity, std::var
     frame.log.push_back(std::format("BindMenu:{}:{}", identity, count + 1));
 }
 
+template <typename Dispatcher>
+inline void MenuBindDispatcher(wxUITests::TestParent& frame, std::shared_ptr<Dispatcher const> dispatcher)
+{
+    frame.log.push_back("BindMenuDispatcher");
+    frame.dispatchMenu = [dispatcher = std::move(dispatcher)](int identity) {
+        auto event = wxCommandEvent {};
+        return dispatcher->dispatch(identity, event);
+    };
+}
+
 // Proxy binding customization points for menu items in tests
 // Note: In tests, we can't actually set the proxy because TestMenuItem* != wxMenuItem*
 // But calling the customization point is sufficient for test coverage
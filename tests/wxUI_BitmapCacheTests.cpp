@@ -0,0 +1,171 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include "TestCustomizations.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <vector>
+#include <wxUI/Bitmap.hpp>
+#include <wxUI/BitmapButton.hpp>
+#include <wxUI/BitmapCache.hpp>
+#include <wxUI/Layout.hpp>
+
+#include <wx/wx.h>
+
+using namespace wxUITests;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
+TEST_CASE("BitmapCache")
+{
+    auto cache = wxUI::BitmapCache {};
+    auto decodes = 0;
+    auto decode = [&decodes](int side) {
+        return [&decodes, side] {
+            ++decodes;
+            return wxBitmap { side, side };
+        };
+    };
+
+    SECTION("decoded.once")
+    {
+        auto first = cache.get("save", decode(16));
+        auto second = cache.get("save", decode(16));
+        CHECK(decodes == 1);
+        CHECK(first.GetImpl() == second.GetImpl());
+        CHECK(second.GetDefaultSize() == wxSize { 16, 16 });
+        CHECK(cache.size() == 1);
+        CHECK(cache.memoryUsed() == 16 * 16 * 4);
+    }
+
+    SECTION("keys")
+    {
+        auto save = cache.get("save", decode(16));
+        auto open = cache.get("open", decode(16));
+        CHECK(decodes == 2);
+        CHECK(cache.size() == 2);
+        CHECK(save.GetImpl() != open.GetImpl());
+        // remembered by key alone, however the bundle would be made
+        CHECK(cache.get("save", decode(32)).GetImpl() == save.GetImpl());
+        CHECK(decodes == 2);
+    }
+
+    SECTION("not.ok")
+    {
+        auto bundle = cache.get("missing", [] { return wxBitmap {}; });
+        CHECK(!bundle.IsOk());
+        CHECK(cache.size() == 0);
+    }
+
+    SECTION("lru")
+    {
+        cache.setMemoryLimit(2 * 16 * 16 * 4);
+        cache.get("save", decode(16));
+        cache.get("open", decode(16));
+        cache.get("save", decode(16));
+        cache.get("close", decode(16));
+        CHECK(decodes == 3);
+        CHECK(cache.size() == 2);
+        cache.get("save", decode(16));
+        CHECK(decodes == 3);
+        cache.get("open", decode(16));
+        CHECK(decodes == 4);
+    }
+
+    SECTION("limit")
+    {
+        cache.get("save", decode(16));
+        cache.get("open", decode(16));
+        cache.setMemoryLimit(16 * 16 * 4);
+        CHECK(cache.size() == 1);
+        CHECK(cache.memoryUsed() == 16 * 16 * 4);
+        auto large = cache.get("splash", decode(64));
+        CHECK(cache.size() == 1);
+        CHECK(cache.memoryUsed() == 64 * 64 * 4);
+        CHECK(large.GetDefaultSize() == wxSize { 64, 64 });
+    }
+
+    SECTION("scales")
+    {
+        cache.setScales({ 1.0, 2.0 });
+        auto bundle = cache.get("save", [] { return wxBitmapBundle::FromBitmaps(wxBitmap { 16, 16 }, wxBitmap { 32, 32 }); });
+        CHECK(cache.memoryUsed() == (16 * 16 + 32 * 32) * 4);
+        cache.setScales({ 1.0 });
+        CHECK(cache.memoryUsed() == 16 * 16 * 4);
+
+        // counting more scales can push the oldest bundles out
+        cache.setMemoryLimit(2 * 16 * 16 * 4);
+        cache.get("open", decode(16));
+        CHECK(cache.size() == 2);
+        cache.setScales({ 1.0, 2.0 });
+        CHECK(cache.size() == 1);
+        cache.get("open", decode(16));
+        CHECK(decodes == 1);
+    }
+
+    SECTION("clear")
+    {
+        cache.get("save", decode(16));
+        cache.clear();
+        CHECK(cache.size() == 0);
+        CHECK(cache.memoryUsed() == 0);
+        cache.get("save", decode(16));
+        CHECK(decodes == 2);
+    }
+
+    SECTION("fromFiles")
+    {
+        auto first = cache.fromFiles("icons", "save");
+        auto second = cache.fromFiles("icons", "save");
+        auto svg = cache.fromFiles("icons", "save", "svg");
+        CHECK(first.IsOk());
+        CHECK(first.GetImpl() == second.GetImpl());
+        CHECK(first.GetImpl() != svg.GetImpl());
+        CHECK(cache.size() == 2);
+    }
+
+    SECTION("controllers")
+    {
+        TestParent frame;
+        wxUI::VSizer {
+            wxUI::Bitmap { cache.get("save", decode(16)) },
+            wxUI::BitmapButton { cache.get("save", decode(16)) },
+        }
+            .fitTo(&frame);
+        CHECK(decodes == 1);
+        CHECK(frame.dump() == std::vector<std::string> {
+                  "Create:Sizer[orientation=wxVERTICAL]",
+                  "Create:wxStaticBitmap[id=-1, pos=(-1,-1), size=(-1,-1), style=0, bitmap=(16,16)]",
+                  "Create:wxBitmapButton[id=-1, pos=(-1,-1), size=(-1,-1), style=0, bitmap=(16,16)]",
+                  "topsizer:Sizer[orientation=wxVERTICAL]",
+                  "controller:wxStaticBitmap[id=-1, pos=(-1,-1), size=(-1,-1), style=0, bitmap=(16,16)]",
+                  "SetEnabled:true",
+                  "controller:wxBitmapButton[id=-1, pos=(-1,-1), size=(-1,-1), style=0, bitmap=(16,16)]",
+                  "SetEnabled:true",
+                  "sizer:Sizer[orientation=wxVERTICAL]",
+                  "Add:wxStaticBitmap[id=-1, pos=(-1,-1), size=(-1,-1), style=0, bitmap=(16,16)]:flags:(0,0x0,0)",
+                  "Add:wxBitmapButton[id=-1, pos=(-1,-1), size=(-1,-1), style=0, bitmap=(16,16)]:flags:(0,0x0,0)",
+                  "SetSizeHints:[id=0, pos=(0,0), size=(0,0), style=0]",
+              });
+    }
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
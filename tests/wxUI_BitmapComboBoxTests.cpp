@@ -170,6 +170,118 @@ TEST_CASE("BitmapComboBox")
         uut.create(&provider);
         CHECK(provider.dump() == testDump(-1, { -1, -1 }, { -1, -1 }, 0, "", { "" }));
     }
+
+    SECTION("provider")
+    {
+        TestParent provider;
+        auto asked = std::vector<size_t> {};
+        auto uut = TypeUnderTest { std::vector<std::string> { "Sans", "Serif", "Mono" }, [&asked](size_t index) {
+                                      asked.push_back(index);
+                                      return wxBitmapBundle { wxBitmap { 16, 16 } };
+                                  } };
+        uut.create(&provider);
+        auto controller = makeController(-1, { -1, -1 }, { -1, -1 }, 0, "Sans", { "Sans", "Serif", "Mono" });
+        CHECK(provider.dump() == Dump { "Create:" + controller, "controller:" + controller, "SetItemBitmap:0:(16,16)", "BindDropDown", "SetSelection:0", "SetEnabled:true" });
+        CHECK(asked == std::vector<size_t> { 0 });
+
+        REQUIRE(provider.parents.front().dropDowns.size() == 1);
+        provider.parents.front().dropDowns.front()();
+        CHECK(asked == std::vector<size_t> { 0, 1, 2 });
+        CHECK(provider.parents.front().log == std::vector<std::string> { "SetItemBitmap:0:(16,16)", "BindDropDown", "SetSelection:0", "SetEnabled:true", "SetItemBitmap:1:(16,16)", "SetItemBitmap:2:(16,16)" });
+        // asked once per item
+        provider.parents.front().dropDowns.front()();
+        CHECK(asked == std::vector<size_t> { 0, 1, 2 });
+    }
+
+    SECTION("provider.id.selection")
+    {
+        TestParent provider;
+        auto asked = std::vector<size_t> {};
+        auto uut = TypeUnderTest { 10000, std::vector<wxString> { "Sans", "Serif" }, [&asked](size_t index) {
+                                      asked.push_back(index);
+                                      return wxBitmapBundle { wxBitmap { 16, 16 } };
+                                  } }
+                       .withSelection(1);
+        uut.create(&provider);
+        CHECK(asked == std::vector<size_t> { 1 });
+        provider.parents.front().dropDowns.front()();
+        CHECK(asked == std::vector<size_t> { 1, 0 });
+    }
+
+    SECTION("provider.itemHeight")
+    {
+        TestParent provider;
+        auto asked = std::vector<size_t> {};
+        auto uut = TypeUnderTest { std::vector<std::string> { "Sans", "Serif", "Mono" }, [&asked](size_t index) {
+                                      asked.push_back(index);
+                                      return wxBitmapBundle { wxBitmap { 16, 16 } };
+                                  } }
+                       .withSelection(2);
+        uut.create(&provider);
+        // sized from the selected item's bitmap before the list drops down
+        CHECK(asked == std::vector<size_t> { 2 });
+        CHECK(provider.parents.front().itemBitmapSize == wxSize { 16, 16 });
+    }
+
+    SECTION("provider.shownWithoutBitmap")
+    {
+        TestParent provider;
+        auto asked = std::vector<size_t> {};
+        auto uut = TypeUnderTest { std::vector<std::string> { "None", "Sans", "Serif" }, [&asked](size_t index) {
+                                      asked.push_back(index);
+                                      return (index == 0) ? wxBitmapBundle {} : wxBitmapBundle { wxBitmap { 16, 16 } };
+                                  } };
+        uut.create(&provider);
+        auto& control = provider.parents.front();
+        CHECK(asked == std::vector<size_t> { 0, 1 });
+        CHECK(control.itemBitmapSize == wxSize { 16, 16 });
+        control.dropDowns.front()();
+        CHECK(asked == std::vector<size_t> { 0, 1, 2 });
+    }
+
+    SECTION("provider.itemsChanged")
+    {
+        TestParent provider;
+        auto asked = std::vector<size_t> {};
+        auto uut = TypeUnderTest { std::vector<std::string> { "Sans", "Serif", "Mono" }, [&asked](size_t index) {
+                                      asked.push_back(index);
+                                      return wxBitmapBundle { wxBitmap { 16, 16 } };
+                                  } };
+        uut.create(&provider);
+        // as if set through the proxy before the list first dropped down
+        provider.parents.front().choices = std::vector<std::string> { "Sans", "Serif" };
+        provider.parents.front().dropDowns.front()();
+        CHECK(asked == std::vector<size_t> { 0, 1 });
+    }
+
+    SECTION("provider.shownReplaced")
+    {
+        TestParent provider;
+        auto asked = std::vector<size_t> {};
+        auto uut = TypeUnderTest { std::vector<std::string> { "Sans", "Serif", "Mono" }, [&asked](size_t index) {
+                                      asked.push_back(index);
+                                      return wxBitmapBundle { wxBitmap { 16, 16 } };
+                                  } };
+        uut.create(&provider);
+        auto& control = provider.parents.front();
+        control.choices = std::vector<std::string> { "Mono", "Serif" };
+        control.dropDowns.front()();
+        CHECK(asked == std::vector<size_t> { 0, 0, 1 });
+
+        // changed after the first drop-down
+        asked.clear();
+        control.choices = std::vector<std::string> { "Mono", "Sans", "Serif" };
+        control.dropDowns.front()();
+        CHECK(asked == std::vector<size_t> { 1, 2 });
+    }
+
+    SECTION("provider.empty")
+    {
+        TestParent provider;
+        auto uut = TypeUnderTest { std::vector<std::string> {}, [](size_t) { return wxBitmapBundle {}; } };
+        uut.create(&provider);
+        CHECK(provider.parents.front().dropDowns.empty());
+    }
     COMMON_TESTS(BitmapComboBoxTestPolicy)
 }
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity, misc-use-anonymous-namespace, cppcoreguidelines-avoid-do-while)
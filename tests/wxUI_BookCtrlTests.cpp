@@ -195,6 +195,91 @@ TEST_CASE("BookCtrl")
                   "Add:wxNotebook[id=-1, pos=(-1,-1), size=(-1,-1), style=0]:flags:(0,0x0,0)",
               });
     }
+
+    SECTION("BookItem.lazy")
+    {
+        TestParent provider;
+        auto uut = Notebook {
+            BookItem { "Page 1", Button { "Button" } },
+            BookItem { "Page 2", Button { "Button" } }.withLazy(),
+        };
+        uut.createAndAdd(&provider, provider.add(TestSizer { .type = SizerType::Box, .orientation = wxVERTICAL }), wxSizerFlags {});
+        auto dump = provider.dump();
+        CHECK(dump == std::vector<std::string> {
+                  "Create:Sizer[orientation=wxVERTICAL]",
+                  "Create:wxNotebook[id=-1, pos=(-1,-1), size=(-1,-1), style=0]",
+                  "controller:wxNotebook[id=-1, pos=(-1,-1), size=(-1,-1), style=0]",
+                  "Create:wxWindow[id=-1, pos=(-1,-1), size=(-1,-1), style=0]",
+                  "Create:wxWindow[id=-1, pos=(-1,-1), size=(-1,-1), style=0]",
+                  "BindLazyPage:wxWindow[id=-1, pos=(-1,-1), size=(-1,-1), style=0]",
+                  "bookPage:wxWindow[id=-1, pos=(-1,-1), size=(-1,-1), style=0]:Page 1:false",
+                  "bookPage:wxWindow[id=-1, pos=(-1,-1), size=(-1,-1), style=0]:Page 2:false",
+                  "sizer:Sizer[orientation=wxVERTICAL]",
+                  "Add:wxNotebook[id=-1, pos=(-1,-1), size=(-1,-1), style=0]:flags:(0,0x0,0)",
+              });
+        auto& book = provider.parents.front();
+        REQUIRE(book.lazyPages.size() == 1);
+        auto& eagerPage = book.parents.front();
+        auto& lazyPage = book.parents.back();
+        CHECK(lazyPage.dump().empty());
+        book.lazyPages.front()();
+        CHECK(lazyPage.dump() == eagerPage.dump());
+    }
+
+    SECTION("BookItem.lazy_outlives_layout")
+    {
+        TestParent provider;
+        {
+            auto uut = Notebook {
+                BookItem { "Page 1",
+                    VSizer {
+                        Button { "Button 1" },
+                        Button { "Button 2" },
+                    } }
+                    .withLazy(),
+            };
+            uut.createAndAdd(&provider, provider.add(TestSizer { .type = SizerType::Box, .orientation = wxVERTICAL }), wxSizerFlags {});
+        }
+        auto& book = provider.parents.front();
+        REQUIRE(book.lazyPages.size() == 1);
+        auto& page = book.parents.front();
+        CHECK(page.dump().empty());
+        book.lazyPages.front()();
+        TestParent eagerProvider;
+        Notebook {
+            BookItem { "Page 1",
+                VSizer {
+                    Button { "Button 1" },
+                    Button { "Button 2" },
+                } },
+        }
+            .createAndAdd(&eagerProvider, eagerProvider.add(TestSizer { .type = SizerType::Box, .orientation = wxVERTICAL }), wxSizerFlags {});
+        CHECK(page.dump() == eagerProvider.parents.front().parents.front().dump());
+    }
+
+    SECTION("BookItem.lazy_binds_proxy_on_realize")
+    {
+        TestParent provider;
+        auto sizerProxy = SizerProxy {};
+        auto uut = Notebook {
+            BookItem { "Page 1",
+                VSizer {
+                    Button { "Button 1" },
+                }
+                    .withProxy(sizerProxy) }
+                .withLazy(),
+        };
+        uut.createAndAdd(&provider, provider.add(TestSizer { .type = SizerType::Box, .orientation = wxVERTICAL }), wxSizerFlags {});
+        auto& book = provider.parents.front();
+        auto& page = book.parents.front();
+        auto boundProxy = [&page] {
+            auto dump = page.dump();
+            return std::ranges::find(dump, "SizerBindProxy:1") != dump.end();
+        };
+        CHECK(!boundProxy());
+        book.lazyPages.front()();
+        CHECK(boundProxy());
+    }
 }
 
 TEST_CASE("Choicebook")
@@ -23,8 +23,10 @@ SOFTWARE.
 */
 #include "TestCustomizations.hpp"
 #include "wxUI_TestControlCommon.hpp"
+#include <array>
 #include <catch2/catch_test_macros.hpp>
 #include <memory>
+#include <vector>
 #include <wxUI/Button.hpp>
 #include <wxUI/Layout.hpp>
 #include <wxUI/wxUITypes.hpp>
@@ -234,8 +236,40 @@ TEST_CASE("Button - Mutable lambda in bind")
     }
 }
 
+TEST_CASE("Button - BindInfo storage")
+{
+    // The shared_ptr use count tracks how many copies of the handler exist.
+    auto check = [](auto makeHandler) {
+        auto token = std::make_shared<int>(0);
+        {
+            auto bindInfo = wxUI::details::BindInfo { wxEVT_BUTTON, makeHandler(token) };
+            CHECK(token.use_count() == 2);
+            auto copy = bindInfo;
+            CHECK(token.use_count() == 3);
+            auto moved = std::move(bindInfo);
+            CHECK(token.use_count() == 3);
+            copy = moved;
+            CHECK(token.use_count() == 3);
+            bindInfo = std::move(copy);
+            CHECK(token.use_count() == 3);
+            auto list = std::vector<wxUI::details::BindInfo>(4, moved);
+            CHECK(token.use_count() == 7);
+        }
+        CHECK(token.use_count() == 1);
+    };
+
+    SECTION("inline")
+    {
+        check([](std::shared_ptr<int> token) { return [token](wxCommandEvent&) { }; });
+    }
+    SECTION("heap")
+    {
+        check([](std::shared_ptr<int> token) { return [token, padding = std::array<char, 256> {}](wxCommandEvent&) { }; });
+    }
+}
+
 // Note: Move-only lambdas (capturing unique_ptr) cannot be used with bind()
 // because wxWidgets' event system requires event handlers to be copyable.
-// BindInfo must support copying via clone(), which is incompatible with move-only types.
+// BindInfo must be copyable, which is incompatible with move-only types.
 
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity, misc-use-anonymous-namespace, cppcoreguidelines-avoid-do-while)
@@ -0,0 +1,222 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include "TestCustomizations.hpp"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <string>
+#include <vector>
+#include <wxUI/ChoiceList.hpp>
+#include <wxUI/ComboBox.hpp>
+#include <wxUI/Layout.hpp>
+#include <wxUI/detail/ChoicesDetails.hpp>
+
+#include <wx/wx.h>
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
+
+namespace {
+// Behaves like a single selection wxItemContainer: inserting and deleting
+// rows moves the selection with its row.
+struct TestItems {
+    std::vector<wxString> items {};
+    int selection { wxNOT_FOUND };
+    std::vector<std::string> log {};
+
+    [[nodiscard]] auto GetCount() const { return static_cast<unsigned>(items.size()); }
+    [[nodiscard]] auto GetString(unsigned row) const { return items.at(row); }
+    [[nodiscard]] auto GetSelection() const { return selection; }
+    void SetSelection(int row)
+    {
+        log.push_back(std::format("SetSelection:{}", row));
+        selection = row;
+    }
+    void Set(wxArrayString const& strings)
+    {
+        log.push_back(std::format("Set:{}", strings.size()));
+        items.assign(strings.begin(), strings.end());
+        selection = wxNOT_FOUND;
+    }
+    void Insert(wxString const& item, unsigned row)
+    {
+        log.push_back(std::format("Insert:{}:{}", item.utf8_string(), row));
+        items.insert(items.begin() + row, item);
+        if (selection >= static_cast<int>(row)) {
+            ++selection;
+        }
+    }
+    void Delete(unsigned row)
+    {
+        log.push_back(std::format("Delete:{}", row));
+        items.erase(items.begin() + row);
+        if (selection == static_cast<int>(row)) {
+            selection = wxNOT_FOUND;
+        } else if (selection > static_cast<int>(row)) {
+            --selection;
+        }
+    }
+};
+
+// A multiple selection list box that forgets its selection on changes.
+struct TestMultiItems : TestItems {
+    std::vector<int> selections {};
+
+    void GetSelections(wxArrayInt& rows) const { rows.assign(selections.begin(), selections.end()); }
+    void SetSelection(int row)
+    {
+        log.push_back(std::format("SetSelection:{}", row));
+        if (row == wxNOT_FOUND) {
+            selections.clear();
+        } else {
+            selections.push_back(row);
+        }
+    }
+    void Insert(wxString const& item, unsigned row)
+    {
+        TestItems::Insert(item, row);
+        selections.clear();
+    }
+    void Delete(unsigned row)
+    {
+        TestItems::Delete(row);
+        selections.clear();
+    }
+};
+
+auto strings(std::vector<std::string> const& items)
+{
+    auto result = std::vector<wxString> {};
+    for (auto const& item : items) {
+        result.push_back(wxString::FromUTF8(item));
+    }
+    return result;
+}
+}
+
+TEST_CASE("Choices")
+{
+    auto control = TestItems { .items = strings({ "apple", "apricot", "banana", "blueberry" }) };
+
+    SECTION("get")
+    {
+        CHECK(wxUI::details::getChoices(&control) == std::vector<std::string> { "apple", "apricot", "banana", "blueberry" });
+    }
+    SECTION("replace")
+    {
+        wxUI::details::setChoices(&control, { "cherry", "date" }, wxUI::ChoicesUpdate::Replace);
+        CHECK(control.log == std::vector<std::string> { "Set:2" });
+        CHECK(control.items == strings({ "cherry", "date" }));
+    }
+    SECTION("narrow")
+    {
+        control.selection = 1;
+        wxUI::details::setChoices(&control, { "apple", "apricot" }, wxUI::ChoicesUpdate::Diff);
+        CHECK(control.log == std::vector<std::string> { "Delete:2", "Delete:2" });
+        CHECK(control.selection == 1);
+    }
+    SECTION("widen")
+    {
+        control.items = strings({ "apricot", "blueberry" });
+        control.selection = 1;
+        wxUI::details::setChoices(&control, { "apple", "apricot", "banana", "blueberry" }, wxUI::ChoicesUpdate::Diff);
+        CHECK(control.log == std::vector<std::string> { "Insert:apple:0", "Insert:banana:2" });
+        CHECK(control.selection == 3);
+    }
+    SECTION("selectionRemoved")
+    {
+        control.selection = 2;
+        wxUI::details::setChoices(&control, { "apple" }, wxUI::ChoicesUpdate::Diff);
+        CHECK(control.items == strings({ "apple" }));
+        CHECK(control.selection == wxNOT_FOUND);
+        CHECK(std::ranges::count_if(control.log, [](auto const& line) { return line.starts_with("SetSelection"); }) == 0);
+    }
+    SECTION("multipleSelection")
+    {
+        auto multi = TestMultiItems {};
+        multi.items = strings({ "a", "b", "c" });
+        multi.selections = { 0, 2 };
+        wxUI::details::setChoices(&multi, { "x", "a", "c" }, wxUI::ChoicesUpdate::Diff);
+        CHECK(multi.items == strings({ "x", "a", "c" }));
+        CHECK(multi.selections == std::vector<int> { 1, 2 });
+    }
+    SECTION("arbitrary")
+    {
+        auto random = std::mt19937 { 42 };
+        auto pick = [&random] {
+            auto result = std::vector<std::string> {};
+            auto length = std::uniform_int_distribution { 0, 8 }(random);
+            for (auto i = 0; i < length; ++i) {
+                result.emplace_back(1, static_cast<char>('a' + std::uniform_int_distribution { 0, 4 }(random)));
+            }
+            return result;
+        };
+        for (auto round = 0; round < 500; ++round) {
+            auto from = pick();
+            auto to = pick();
+            auto items = TestItems { .items = strings(from) };
+            wxUI::details::setChoices(&items, to, wxUI::ChoicesUpdate::Diff);
+            REQUIRE(items.items == strings(to));
+        }
+    }
+}
+
+TEST_CASE("ChoiceList")
+{
+    SECTION("empty")
+    {
+        auto list = wxUI::ChoiceList {};
+        CHECK(list.empty());
+        CHECK(list.begin() == list.end());
+        CHECK_THROWS_AS(list.at(0), std::out_of_range);
+    }
+    SECTION("build")
+    {
+        auto names = std::vector<std::string> { "metre", "foot" };
+        auto fromRange = wxUI::ChoiceList { names };
+        auto fromList = wxUI::ChoiceList { "metre", "foot" };
+        CHECK(std::ranges::equal(fromRange, strings(names)));
+        CHECK(std::ranges::equal(fromList, strings(names)));
+        CHECK(!fromRange.shares(fromList));
+    }
+    SECTION("shared")
+    {
+        auto units = wxUI::ChoiceList { "metre", "foot" };
+        auto copy = units;
+        CHECK(copy.shares(units));
+        CHECK(copy.data() == units.data());
+        CHECK(wxUI::details::toChoiceList(units).shares(units));
+        CHECK(!wxUI::details::toChoiceList(std::vector<std::string> { "metre", "foot" }).shares(units));
+    }
+    SECTION("controllers")
+    {
+        auto units = wxUI::ChoiceList { "metre", "foot" };
+        wxUITests::TestParent expected;
+        wxUI::VSizer { wxUI::ComboBox { "metre", "foot" }, wxUI::ComboBox { "metre", "foot" } }.fitTo(&expected);
+        wxUITests::TestParent frame;
+        wxUI::VSizer { wxUI::ComboBox { units }, wxUI::ComboBox { units } }.fitTo(&frame);
+        CHECK(frame.dump() == expected.dump());
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
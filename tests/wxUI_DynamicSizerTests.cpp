@@ -0,0 +1,111 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include "TestCustomizations.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <vector>
+#include <wxUI/Button.hpp>
+#include <wxUI/DynamicSizer.hpp>
+#include <wxUI/Layout.hpp>
+#include <wxUI/Text.hpp>
+
+#include <wx/wx.h>
+
+using namespace wxUITests;
+
+namespace {
+using DynamicVSizer = wxUI::DynamicVSizer<TestParent, TestSizer>;
+using DynamicHSizer = wxUI::DynamicHSizer<TestParent, TestSizer>;
+using Item = wxUI::details::DynamicItem<TestParent, TestSizer>;
+
+template <typename Layout>
+auto dumpOf(Layout&& layout) -> std::vector<std::string>
+{
+    TestParent frame;
+    std::forward<Layout>(layout).fitTo(&frame);
+    return frame.dump();
+}
+} // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
+TEST_CASE("DynamicSizer")
+{
+    SECTION("vSizer.empty")
+    {
+        CHECK(dumpOf(DynamicVSizer {}) == dumpOf(wxUI::VSizer {}));
+    }
+    SECTION("hSizer.named.flags")
+    {
+        CHECK(dumpOf(DynamicHSizer { "Named", wxSizerFlags {}.Border() }) == dumpOf(wxUI::HSizer { "Named", wxSizerFlags {}.Border() }));
+    }
+    SECTION("vSizer.items")
+    {
+        auto layout = DynamicVSizer {};
+        layout.reserve(3);
+        for (auto const* label : { "A", "B", "C" }) {
+            layout.add(wxUI::Button { label });
+        }
+        CHECK(layout.size() == 3);
+        CHECK(dumpOf(layout) == dumpOf(wxUI::VSizer { wxUI::Button { "A" }, wxUI::Button { "B" }, wxUI::Button { "C" } }));
+    }
+    SECTION("vSizer.mixed")
+    {
+        auto layout = DynamicVSizer { wxSizerFlags {}.Expand() }
+                          .add(wxUI::Text { "Label" })
+                          .add(wxUI::Spacer { 5 })
+                          .add(wxUI::HSizer { wxUI::Button { "Ok" }, wxUI::Button { "Cancel" } })
+                          .add(wxUI::StretchSpacer {});
+        CHECK(dumpOf(layout) == dumpOf(wxUI::VSizer { wxSizerFlags {}.Expand(), wxUI::Text { "Label" }, wxUI::Spacer { 5 }, wxUI::HSizer { wxUI::Button { "Ok" }, wxUI::Button { "Cancel" } }, wxUI::StretchSpacer {} }));
+    }
+    SECTION("nested")
+    {
+        auto inner = DynamicHSizer { "Inner" }.add(wxUI::Button { "Child" });
+        auto outer = DynamicVSizer {}.add(wxUI::Text { "Top" }).add(inner);
+        auto expected = dumpOf(wxUI::VSizer { wxUI::Text { "Top" }, wxUI::HSizer { "Inner", wxUI::Button { "Child" } } });
+        CHECK(dumpOf(outer) == expected);
+        CHECK(dumpOf(wxUI::VSizer { wxUI::Text { "Top" }, inner }) == expected);
+    }
+    SECTION("copy")
+    {
+        auto layout = DynamicVSizer {}.add(wxUI::Button { "A" }).add(wxUI::VSizer { wxUI::Button { "B" } });
+        auto copy = layout;
+        auto moved = std::move(layout);
+        CHECK(dumpOf(copy) == dumpOf(moved));
+        CHECK(dumpOf(copy) == dumpOf(wxUI::VSizer { wxUI::Button { "A" }, wxUI::VSizer { wxUI::Button { "B" } } }));
+    }
+    SECTION("withProxy")
+    {
+        wxUI::SizerProxy proxy {};
+        auto dump = dumpOf(DynamicVSizer {}.add(wxUI::Button { "A" }).withProxy(proxy));
+        CHECK(std::ranges::count(dump, std::string { "SizerBindProxy:1" }) == 1);
+    }
+    SECTION("storage")
+    {
+        STATIC_REQUIRE(Item::storedInline<wxUI::Button>());
+        STATIC_REQUIRE(Item::storedInline<wxUI::Text>());
+        STATIC_REQUIRE(Item::storedInline<wxUI::Spacer>());
+        STATIC_REQUIRE(std::is_nothrow_move_constructible_v<Item>);
+    }
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
@@ -23,6 +23,7 @@ SOFTWARE.
 */
 #include "TestCustomizations.hpp"
 #include <catch2/catch_test_macros.hpp>
+#include <format>
 #include <memory>
 #include <ranges>
 #include <wxUI/Button.hpp>
@@ -530,4 +531,261 @@ TEST_CASE("ForEach - Move-only mutable lambda")
         CHECK(dump.size() > 0);
     }
 }
+
+TEST_CASE("KeyedForEach")
+{
+    auto button = [](std::string const& name) {
+        return std::format("wxButton[id=-1, pos=(-1,-1), size=(-1,-1), style=0, text=\"{}\"]", name);
+    };
+    auto children = [&button](std::vector<std::string> const& names) {
+        auto result = std::vector<std::string> {};
+        for (auto const& name : names) {
+            result.push_back(button(name));
+        }
+        return result;
+    };
+    auto sizerLog = [](TestParent const& frame) {
+        auto result = std::vector<std::string> {};
+        for (auto const& entry : frame.sizers.front().log) {
+            if (!entry.starts_with("Add:") && !entry.starts_with("SetSizeHints:")) {
+                result.push_back(entry);
+            }
+        }
+        return result;
+    };
+    auto created = std::vector<std::string> {};
+    auto makeButton = [&created](std::string const& name) {
+        created.push_back(name);
+        return wxUI::Button { name };
+    };
+    auto identity = [](std::string const& name) { return name; };
+
+    SECTION("create")
+    {
+        TestParent frame;
+        wxUI::VSizer {
+            wxUI::KeyedForEach { std::vector<std::string> { "A", "B", "C" }, identity, makeButton },
+        }
+            .fitTo(&frame);
+        CHECK(frame.sizers.front().children == children({ "A", "B", "C" }));
+        CHECK(created == std::vector<std::string> { "A", "B", "C" });
+    }
+    SECTION("update.keepsExisting")
+    {
+        TestParent frame;
+        auto proxy = wxUI::KeyedForEachProxy<std::string> {};
+        wxUI::VSizer {
+            wxUI::KeyedForEach { std::vector<std::string> { "A", "B", "C" }, identity, makeButton }.withProxy(proxy),
+        }
+            .fitTo(&frame);
+        created.clear();
+        proxy.update(std::vector<std::string> { "A", "B", "C" });
+        CHECK(frame.sizers.front().children == children({ "A", "B", "C" }));
+        CHECK(created.empty());
+        CHECK(sizerLog(frame) == std::vector<std::string> { "BeginUpdate", "EndUpdate" });
+    }
+    SECTION("update.insert")
+    {
+        TestParent frame;
+        auto proxy = wxUI::KeyedForEachProxy<std::string> {};
+        wxUI::VSizer {
+            wxUI::KeyedForEach { std::vector<std::string> { "A", "C" }, identity, makeButton }.withProxy(proxy),
+        }
+            .fitTo(&frame);
+        created.clear();
+        proxy.update(std::vector<std::string> { "A", "B", "C", "D" });
+        CHECK(frame.sizers.front().children == children({ "A", "B", "C", "D" }));
+        CHECK(created == std::vector<std::string> { "D", "B" });
+        CHECK(sizerLog(frame) == std::vector<std::string> { "BeginUpdate", "Move:3:1", "EndUpdate" });
+    }
+    SECTION("update.remove")
+    {
+        TestParent frame;
+        auto proxy = wxUI::KeyedForEachProxy<std::string> {};
+        wxUI::VSizer {
+            wxUI::KeyedForEach { std::vector<std::string> { "A", "B", "C", "D" }, identity, makeButton }.withProxy(proxy),
+        }
+            .fitTo(&frame);
+        created.clear();
+        proxy.update(std::vector<std::string> { "B", "D" });
+        CHECK(frame.sizers.front().children == children({ "B", "D" }));
+        CHECK(created.empty());
+        CHECK(sizerLog(frame) == std::vector<std::string> { "BeginUpdate", "Remove:2", "Remove:0", "EndUpdate" });
+    }
+    SECTION("update.reorder")
+    {
+        TestParent frame;
+        auto proxy = wxUI::KeyedForEachProxy<std::string> {};
+        wxUI::VSizer {
+            wxUI::KeyedForEach { std::vector<std::string> { "A", "B", "C", "D", "E" }, identity, makeButton }.withProxy(proxy),
+        }
+            .fitTo(&frame);
+        created.clear();
+        proxy.update(std::vector<std::string> { "E", "A", "B", "C", "D" });
+        CHECK(frame.sizers.front().children == children({ "E", "A", "B", "C", "D" }));
+        CHECK(created.empty());
+        CHECK(sizerLog(frame) == std::vector<std::string> { "BeginUpdate", "Move:4:0", "EndUpdate" });
+
+        proxy.update(std::vector<std::string> { "D", "C", "B", "A", "E" });
+        CHECK(frame.sizers.front().children == children({ "D", "C", "B", "A", "E" }));
+        CHECK(created.empty());
+    }
+    SECTION("update.mixed")
+    {
+        TestParent frame;
+        auto proxy = wxUI::KeyedForEachProxy<std::string> {};
+        wxUI::VSizer {
+            wxUI::KeyedForEach { std::vector<std::string> { "A", "B", "C", "D" }, identity, makeButton }.withProxy(proxy),
+        }
+            .fitTo(&frame);
+        created.clear();
+        proxy.update(std::vector<std::string> { "D", "X", "B", "Y" });
+        CHECK(frame.sizers.front().children == children({ "D", "X", "B", "Y" }));
+        CHECK(created == std::vector<std::string> { "Y", "X" });
+    }
+    SECTION("update.siblings")
+    {
+        TestParent frame;
+        auto proxy = wxUI::KeyedForEachProxy<std::string> {};
+        wxUI::VSizer {
+            wxUI::Button { "Before" },
+            wxUI::KeyedForEach { std::vector<std::string> { "A", "B" }, identity, makeButton }.withProxy(proxy),
+            wxUI::Button { "After" },
+        }
+            .fitTo(&frame);
+        proxy.update(std::vector<std::string> { "C", "B" });
+        CHECK(frame.sizers.front().children == children({ "Before", "C", "B", "After" }));
+        proxy.update(std::vector<std::string> {});
+        CHECK(frame.sizers.front().children == children({ "Before", "After" }));
+        proxy.update(std::vector<std::string> { "A", "B" });
+        CHECK(frame.sizers.front().children == children({ "Before", "A", "B", "After" }));
+    }
+    SECTION("update.blockMoved")
+    {
+        TestParent frame;
+        auto first = wxUI::KeyedForEachProxy<std::string> {};
+        auto second = wxUI::KeyedForEachProxy<std::string> {};
+        wxUI::VSizer {
+            wxUI::KeyedForEach { std::vector<std::string> { "A" }, identity, makeButton }.withProxy(first),
+            wxUI::KeyedForEach { std::vector<std::string> { "X", "Y" }, identity, makeButton }.withProxy(second),
+        }
+            .fitTo(&frame);
+        first.update(std::vector<std::string> { "A", "B", "C" });
+        second.update(std::vector<std::string> { "Y", "X" });
+        CHECK(frame.sizers.front().children == children({ "A", "B", "C", "Y", "X" }));
+        first.update(std::vector<std::string> { "C" });
+        second.update(std::vector<std::string> { "X", "Z" });
+        CHECK(frame.sizers.front().children == children({ "C", "X", "Z" }));
+        first.update(std::vector<std::string> {});
+        second.update(std::vector<std::string> { "Z", "X" });
+        CHECK(frame.sizers.front().children == children({ "Z", "X" }));
+    }
+    SECTION("update.emptyBlockMoved")
+    {
+        TestParent frame;
+        auto first = wxUI::KeyedForEachProxy<std::string> {};
+        auto second = wxUI::KeyedForEachProxy<std::string> {};
+        wxUI::VSizer {
+            wxUI::KeyedForEach { std::vector<std::string> { "A" }, identity, makeButton }.withProxy(first),
+            wxUI::KeyedForEach { std::vector<std::string> { "X" }, identity, makeButton }.withProxy(second),
+            wxUI::Button { "After" },
+        }
+            .fitTo(&frame);
+        second.update(std::vector<std::string> {});
+        first.update(std::vector<std::string> { "A", "B", "C" });
+        second.update(std::vector<std::string> { "Y" });
+        CHECK(frame.sizers.front().children == children({ "A", "B", "C", "Y", "After" }));
+    }
+    SECTION("update.large")
+    {
+        TestParent frame;
+        auto proxy = wxUI::KeyedForEachProxy<std::string> {};
+        auto names = std::vector<std::string> {};
+        for (auto i = 0; i < 200; ++i) {
+            names.push_back(std::to_string(i));
+        }
+        wxUI::VSizer {
+            wxUI::Button { "Before" },
+            wxUI::KeyedForEach { names, identity, makeButton }.withProxy(proxy),
+            wxUI::Button { "After" },
+        }
+            .fitTo(&frame);
+        auto shuffled = std::vector<std::string> {};
+        for (auto i = 0; i < 250; ++i) {
+            if (i % 7 != 3) {
+                shuffled.push_back(std::to_string((i * 37) % 250));
+            }
+        }
+        proxy.update(shuffled);
+        auto expected = std::vector<std::string> { "Before" };
+        expected.insert(expected.end(), shuffled.begin(), shuffled.end());
+        expected.push_back("After");
+        CHECK(frame.sizers.front().children == children(expected));
+    }
+    SECTION("update.range")
+    {
+        TestParent frame;
+        auto proxy = wxUI::KeyedForEachProxy<std::string> {};
+        wxUI::VSizer {
+            wxUI::KeyedForEach { std::vector<std::string> { "A", "B" }, identity, makeButton }.withProxy(proxy),
+        }
+            .fitTo(&frame);
+        auto names = std::vector<std::string> { "A", "B", "C", "D" };
+        proxy.update(names | std::views::filter([](auto const& name) { return name != "B"; }));
+        CHECK(frame.sizers.front().children == children({ "A", "C", "D" }));
+    }
+    SECTION("tuple")
+    {
+        TestParent frame;
+        auto proxy = wxUI::KeyedForEachProxy<std::tuple<int, std::string>> {};
+        wxUI::VSizer {
+            wxUI::KeyedForEach {
+                std::vector<std::tuple<int, std::string>> { { 1, "A" }, { 2, "B" } },
+                [](int id, std::string const&) { return id; },
+                [](int, std::string const& name) { return wxUI::Button { name }; } }
+                .withProxy(proxy),
+        }
+            .fitTo(&frame);
+        proxy.update(std::vector<std::tuple<int, std::string>> { { 2, "B" }, { 1, "A" } });
+        CHECK(frame.sizers.front().children == children({ "B", "A" }));
+    }
+    SECTION("duplicateKey")
+    {
+        TestParent frame;
+        auto layout = wxUI::VSizer {
+            wxUI::KeyedForEach { std::vector<std::string> { "A", "A" }, identity, makeButton },
+        };
+        CHECK_THROWS(layout.fitTo(&frame));
+    }
+    SECTION("duplicateKey.update")
+    {
+        TestParent frame;
+        auto proxy = wxUI::KeyedForEachProxy<std::string> {};
+        wxUI::VSizer {
+            wxUI::KeyedForEach { std::vector<std::string> { "A" }, identity, makeButton }.withProxy(proxy),
+        }
+            .fitTo(&frame);
+        CHECK_THROWS(proxy.update(std::vector<std::string> { "B", "B" }));
+        CHECK(frame.sizers.front().children == children({ "A" }));
+    }
+    SECTION("unattached")
+    {
+        auto proxy = wxUI::KeyedForEachProxy<std::string> {};
+        CHECK_THROWS(proxy.update(std::vector<std::string> { "A" }));
+    }
+    SECTION("parentDestroyed")
+    {
+        TestParent frame;
+        auto proxy = wxUI::KeyedForEachProxy<std::string> {};
+        wxUI::VSizer {
+            wxUI::KeyedForEach { std::vector<std::string> { "A" }, identity, makeButton }.withProxy(proxy),
+        }
+            .fitTo(&frame);
+        frame.destroy();
+        created.clear();
+        CHECK_THROWS(proxy.update(std::vector<std::string> { "A", "B" }));
+        CHECK(created.empty());
+    }
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
@@ -43,6 +43,7 @@ struct GaugeTestPolicy {
     static auto expectedSize() { return testSize(); }
 };
 static auto createUUT() { return GaugeTestPolicy::createUUT(); }
+static_assert(std::is_same_v<decltype(std::declval<TypeUnderTest::Proxy const&>().progress()), wxUI::ProgressReporter>);
 
 namespace {
 using Dump = std::vector<std::string>;
@@ -0,0 +1,217 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include "TestCustomizations.hpp"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <wxUI/LayoutImage.hpp>
+
+#include <wx/wx.h>
+
+using namespace wxUITests;
+
+namespace {
+using Kind = wxUI::LayoutImage::Kind;
+using Node = wxUI::LayoutImage::Node;
+
+template <typename Layout>
+auto dumpOf(Layout&& layout) -> std::vector<std::string>
+{
+    TestParent frame;
+    std::forward<Layout>(layout).fitTo(&frame);
+    return frame.dump();
+}
+
+auto dumpOfImage(Node const& root) -> std::vector<std::string>
+{
+    auto bytes = wxUI::LayoutImage::serialize(root);
+    return dumpOf(wxUI::LayoutImage { bytes });
+}
+
+auto occurrences(std::vector<std::byte> const& bytes, std::string_view text)
+{
+    auto count = 0;
+    auto const* data = reinterpret_cast<char const*>(bytes.data());
+    for (auto view = std::string_view { data, bytes.size() }; view.find(text) != std::string_view::npos; view.remove_prefix(view.find(text) + text.size())) {
+        ++count;
+    }
+    return count;
+}
+} // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
+TEST_CASE("LayoutImage")
+{
+    SECTION("vSizer.empty")
+    {
+        CHECK(dumpOfImage(Node { .kind = Kind::VSizer }) == dumpOf(wxUI::VSizer {}));
+    }
+    SECTION("controllers")
+    {
+        auto root = Node {
+            .kind = Kind::VSizer,
+            .children = {
+                { .kind = Kind::Text, .text = "Label" },
+                { .kind = Kind::Button, .text = "Ok" },
+                { .kind = Kind::CheckBox, .text = "Check", .value = 1 },
+                { .kind = Kind::TextCtrl, .text = "Edit" },
+                { .kind = Kind::Choice, .choices = { "A", "B" }, .value = 1 },
+                { .kind = Kind::ComboBox, .choices = { "C", "D" } },
+                { .kind = Kind::ListBox, .choices = { "E", "F" }, .value = 0 },
+                { .kind = Kind::Slider, .value = 5, .range = std::pair { 0, 10 } },
+                { .kind = Kind::SpinCtrl, .range = std::pair { 1, 3 } },
+                { .kind = Kind::Gauge, .range = std::pair { 0, 50 } },
+                { .kind = Kind::HLine },
+                { .kind = Kind::Spacer, .value = 5 },
+                { .kind = Kind::StretchSpacer },
+            },
+        };
+        CHECK(dumpOfImage(root) == dumpOf(wxUI::VSizer {
+                  wxUI::Text { "Label" },
+                  wxUI::Button { "Ok" },
+                  wxUI::CheckBox { "Check" }.withValue(true),
+                  wxUI::TextCtrl { "Edit" },
+                  wxUI::Choice { "A", "B" }.withSelection(1),
+                  wxUI::ComboBox { "C", "D" },
+                  wxUI::ListBox { "E", "F" }.withSelection(0),
+                  wxUI::Slider { std::pair { 0, 10 }, 5 },
+                  wxUI::SpinCtrl { std::pair { 1, 3 } },
+                  wxUI::Gauge { wxUI::Gauge::withRange {}, 50 },
+                  wxUI::HLine(),
+                  wxUI::Spacer { 5 },
+                  wxUI::StretchSpacer {},
+              }));
+    }
+    SECTION("nested.caption.flags")
+    {
+        auto root = Node {
+            .kind = Kind::HSizer,
+            .text = "Named",
+            .flags = wxSizerFlags {}.Border(),
+            .children = {
+                { .kind = Kind::Button, .text = "Left", .flags = wxSizerFlags { 1 }.Expand() },
+                { .kind = Kind::VSizer, .flags = wxSizerFlags {}.Border(wxLEFT, 2), .children = { { .kind = Kind::Text, .text = "Top" }, { .kind = Kind::Text, .text = "Bottom" } } },
+                { .kind = Kind::Button, .text = "Right" },
+            },
+        };
+        CHECK(dumpOfImage(root) == dumpOf(wxUI::HSizer { "Named", wxSizerFlags {}.Border(), wxUI::Button { "Left" }.withFlags(wxSizerFlags { 1 }.Expand()), wxUI::VSizer { wxSizerFlags {}.Border(wxLEFT, 2), wxUI::Text { "Top" }, wxUI::Text { "Bottom" } }, wxUI::Button { "Right" } }));
+    }
+    SECTION("inStaticLayout")
+    {
+        auto bytes = wxUI::LayoutImage::serialize({ .kind = Kind::HSizer, .children = { { .kind = Kind::Button, .text = "Ok" } } });
+        CHECK(dumpOf(wxUI::VSizer { wxUI::Text { "Before" }, wxUI::LayoutImage { bytes }, wxUI::Text { "After" } })
+            == dumpOf(wxUI::VSizer { wxUI::Text { "Before" }, wxUI::HSizer { wxUI::Button { "Ok" } }, wxUI::Text { "After" } }));
+    }
+    SECTION("strings.shared")
+    {
+        auto bytes = wxUI::LayoutImage::serialize({
+            .kind = Kind::VSizer,
+            .children = {
+                { .kind = Kind::Button, .text = "Again" },
+                { .kind = Kind::Choice, .choices = { "Again", "Once" } },
+            },
+        });
+        CHECK(occurrences(bytes, "Again") == 1);
+        CHECK(occurrences(bytes, "Once") == 1);
+    }
+    SECTION("choices.empty")
+    {
+        auto root = Node {
+            .kind = Kind::VSizer,
+            .children = {
+                { .kind = Kind::Choice, .choices = { "", "A" }, .value = 0 },
+                { .kind = Kind::ListBox, .choices = { "B", "" } },
+            },
+        };
+        CHECK_NOTHROW(wxUI::LayoutImage { wxUI::LayoutImage::serialize(root) });
+        CHECK(dumpOfImage(root) == dumpOf(wxUI::VSizer { wxUI::Choice { "", "A" }.withSelection(0), wxUI::ListBox { "B", "" } }));
+    }
+    SECTION("proxy")
+    {
+        auto bytes = wxUI::LayoutImage::serialize({
+            .kind = Kind::VSizer,
+            .proxy = "sizer",
+            .children = {
+                { .kind = Kind::Button, .text = "Ok", .proxy = "ok" },
+                { .kind = Kind::Button, .text = "Cancel", .proxy = "unused" },
+            },
+        });
+        auto ok = wxUI::Button::Proxy {};
+        auto sizer = wxUI::SizerProxy {};
+        CHECK(dumpOf(wxUI::LayoutImage { bytes }.withProxy("ok", ok).withProxy("sizer", sizer))
+            == dumpOf(wxUI::VSizer { wxUI::Button { "Ok" }.withProxy(ok), wxUI::Button { "Cancel" } }.withProxy(sizer)));
+
+        auto text = wxUI::Text::Proxy {};
+        CHECK_THROWS_AS(dumpOf(wxUI::LayoutImage { bytes }.withProxy("ok", text)), std::runtime_error);
+    }
+    SECTION("malformed")
+    {
+        auto bytes = wxUI::LayoutImage::serialize({ .kind = Kind::VSizer, .children = { { .kind = Kind::Button, .text = "Ok" } } });
+        CHECK_NOTHROW(wxUI::LayoutImage { bytes });
+        CHECK_THROWS_AS(wxUI::LayoutImage { std::span { bytes }.first(16) }, std::runtime_error);
+        CHECK_THROWS_AS(wxUI::LayoutImage { std::span { bytes }.first(bytes.size() - 1) }, std::runtime_error);
+
+        auto badMagic = bytes;
+        badMagic[0] = std::byte { 'X' };
+        CHECK_THROWS_AS(wxUI::LayoutImage { badMagic }, std::runtime_error);
+
+        auto badVersion = bytes;
+        badVersion[4] = std::byte { 2 };
+        CHECK_THROWS_AS(wxUI::LayoutImage { badVersion }, std::runtime_error);
+
+        // the button claims a child.
+        auto badNesting = bytes;
+        badNesting[32 + 48 + 4] = std::byte { 1 };
+        CHECK_THROWS_AS(wxUI::LayoutImage { badNesting }, std::runtime_error);
+
+        CHECK_THROWS_AS(wxUI::LayoutImage::serialize({ .kind = Kind::Button, .children = { { .kind = Kind::Text } } }), std::runtime_error);
+
+        auto controllerRoot = wxUI::LayoutImage::serialize({ .kind = Kind::Button });
+        CHECK_THROWS_AS(dumpOf(wxUI::LayoutImage { controllerRoot }), std::runtime_error);
+    }
+    SECTION("mapped")
+    {
+        auto root = Node { .kind = Kind::VSizer, .text = "Mapped", .children = { { .kind = Kind::Text, .text = "From a file" } } };
+        auto bytes = wxUI::LayoutImage::serialize(root);
+        auto path = std::filesystem::temp_directory_path() / "wxUI_LayoutImageTests.wxul";
+        {
+            auto file = std::ofstream { path, std::ios::binary };
+            file.write(reinterpret_cast<char const*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        }
+        {
+            auto mapped = wxUI::MappedLayout { path };
+            CHECK(std::ranges::equal(mapped.image().bytes(), bytes));
+            CHECK(dumpOf(mapped.image()) == dumpOfImage(root));
+        }
+        std::filesystem::remove(path);
+        CHECK_THROWS_AS(wxUI::MappedLayout { path }, std::runtime_error);
+    }
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
@@ -23,6 +23,7 @@ SOFTWARE.
 */
 #include "TestCustomizations.hpp"
 #include <catch2/catch_test_macros.hpp>
+#include <memory>
 #include <ranges>
 #include <string>
 #include <string_view>
@@ -175,6 +176,31 @@ TEST_CASE("Size")
                   "SetSizeHints:[id=0, pos=(0,0), size=(0,0), style=0]",
               });
     }
+    SECTION("vSizer.withButton.copied")
+    {
+        auto layout = wxUI::VSizer { wxUI::Button { "Hello" } };
+        auto copy = layout;
+        TestParent frame;
+        layout.fitTo(&frame);
+        TestParent copyFrame;
+        copy.fitTo(&copyFrame);
+        CHECK(frame.dump() == copyFrame.dump());
+        TestParent outerFrame;
+        wxUI::HSizer { layout }.fitTo(&outerFrame);
+        CHECK(outerFrame.dump() == std::vector<std::string> {
+                  "Create:Sizer[orientation=wxHORIZONTAL]",
+                  "Create:Sizer[orientation=wxVERTICAL]",
+                  "Create:wxButton[id=-1, pos=(-1,-1), size=(-1,-1), style=0, text=\"Hello\"]",
+                  "topsizer:Sizer[orientation=wxHORIZONTAL]",
+                  "controller:wxButton[id=-1, pos=(-1,-1), size=(-1,-1), style=0, text=\"Hello\"]",
+                  "SetEnabled:true",
+                  "sizer:Sizer[orientation=wxHORIZONTAL]",
+                  "AddSizer:Sizer[orientation=wxVERTICAL]:flags:(0,0x0,0)",
+                  "SetSizeHints:[id=0, pos=(0,0), size=(0,0), style=0]",
+                  "sizer:Sizer[orientation=wxVERTICAL]",
+                  "Add:wxButton[id=-1, pos=(-1,-1), size=(-1,-1), style=0, text=\"Hello\"]:flags:(0,0x0,0)",
+              });
+    }
     SECTION("vSizer.withButton.withProxy")
     {
         TestParent frame;
@@ -740,4 +766,117 @@ TEST_CASE("Size")
         CHECK(frame.dump() == gridSizerWithButtonDump(2, true, 1));
     }
 }
+
+TEST_CASE("Dispatcher")
+{
+    SECTION("vSizer.withDispatcher")
+    {
+        TestParent frame;
+        auto calls = std::vector<std::string> {};
+        wxUI::VSizer {
+            wxUI::Button { wxID_OK, "OK" }.bind([&calls] { calls.push_back("ok"); }),
+            wxUI::HSizer {
+                wxUI::Button { wxID_CANCEL, "Cancel" }.bind([&calls](wxCommandEvent&) { calls.push_back("cancel"); }),
+            },
+            wxUI::Button { wxID_APPLY, "Apply" },
+        }
+            .withDispatcher()
+            .fitTo(&frame);
+
+        CHECK(std::ranges::count(frame.log, "BindDispatcher:1") == 1);
+        REQUIRE(frame.parents.size() == 3);
+        auto const& ok = *frame.parents.begin();
+        auto const& cancel = *std::next(frame.parents.begin());
+        auto const& apply = frame.parents.back();
+        CHECK(ok.log == std::vector<std::string> { "SetEnabled:true", "DispatchEvents:1" });
+        CHECK(cancel.log == std::vector<std::string> { "SetEnabled:true", "DispatchEvents:1" });
+        CHECK(apply.log == std::vector<std::string> { "SetEnabled:true" });
+
+        REQUIRE(frame.dispatchEvent);
+        auto event = wxCommandEvent {};
+        CHECK(frame.dispatchEvent(wxEVT_BUTTON, &ok, event));
+        CHECK(frame.dispatchEvent(wxEVT_BUTTON, &cancel, event));
+        CHECK(!frame.dispatchEvent(wxEVT_BUTTON, &apply, event));
+        CHECK(!frame.dispatchEvent(wxEVT_TEXT_ENTER, &ok, event));
+        // a control with the same id is not the one the handler is for.
+        auto recycled = TestParent {};
+        recycled.id = wxID_OK;
+        CHECK(!frame.dispatchEvent(wxEVT_BUTTON, &recycled, event));
+        CHECK(calls == std::vector<std::string> { "ok", "cancel" });
+    }
+    SECTION("skip")
+    {
+        TestParent frame;
+        auto calls = std::vector<std::string> {};
+        wxUI::VSizer {
+            wxUI::Button { wxID_OK, "OK" }
+                .bind([&calls] { calls.push_back("first"); })
+                .bind([&calls](wxCommandEvent& event) {
+                    calls.push_back("second");
+                    event.Skip();
+                })
+                .bind([&calls](wxCommandEvent& event) {
+                    calls.push_back("third");
+                    event.Skip();
+                }),
+        }
+            .withDispatcher()
+            .fitTo(&frame);
+
+        auto event = wxCommandEvent {};
+        CHECK(frame.dispatchEvent(wxEVT_BUTTON, &frame.parents.front(), event));
+        CHECK(calls == std::vector<std::string> { "third", "second", "first" });
+    }
+    SECTION("nonCommandEvents")
+    {
+        TestParent frame;
+        wxUI::VSizer {
+            wxUI::Button { wxID_OK, "OK" }
+                .bind([] { })
+                .bind(wxEVT_SIZE, [](wxSizeEvent&) { }),
+        }
+            .withDispatcher()
+            .fitTo(&frame);
+
+        CHECK(frame.parents.front().log == std::vector<std::string> { "SetEnabled:true", "DispatchEvents:1", "BindEvents:1" });
+    }
+    SECTION("withoutDispatcher")
+    {
+        TestParent frame;
+        wxUI::VSizer {
+            wxUI::Button { wxID_OK, "OK" }.bind([] { }),
+        }
+            .fitTo(&frame);
+
+        CHECK(!frame.dispatchEvent);
+        CHECK(frame.parents.front().log == std::vector<std::string> { "SetEnabled:true", "BindEvents:1" });
+        CHECK(wxUI::details::EventDispatcher::current() == nullptr);
+    }
+    SECTION("destroyedChildren")
+    {
+        TestParent frame;
+        auto calls = 0;
+        wxUI::VSizer {
+            wxUI::Button { wxID_OK, "OK" }
+                .bind([&calls] { ++calls; })
+                .bind([](wxCommandEvent& event) { event.Skip(); }),
+            wxUI::HSizer {
+                wxUI::Button { wxID_CANCEL, "Cancel" }.bind([&calls] { ++calls; }),
+            },
+        }
+            .withDispatcher()
+            .fitTo(&frame);
+
+        REQUIRE(frame.parents.size() == 2);
+        auto& ok = frame.parents.front();
+        auto& cancel = frame.parents.back();
+        auto event = wxCommandEvent {};
+        CHECK(frame.dispatchEvent(wxEVT_BUTTON, &ok, event));
+        // the container hears of the control going and drops its handlers.
+        ok.destroy();
+        CHECK(!frame.dispatchEvent(wxEVT_BUTTON, &ok, event));
+        CHECK(frame.dispatchEvent(wxEVT_BUTTON, &cancel, event));
+        CHECK(calls == 2);
+    }
+}
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
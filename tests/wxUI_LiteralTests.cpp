@@ -0,0 +1,74 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include "wxUI_TestControlCommon.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <wxUI/Choice.hpp>
+#include <wxUI/Layout.hpp>
+#include <wxUI/Literal.hpp>
+#include <wxUI/Text.hpp>
+
+#include <wx/wx.h>
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity, misc-use-anonymous-namespace, cppcoreguidelines-avoid-do-while)
+using namespace wxUITests;
+using namespace wxUI::literals;
+
+TEST_CASE("Literal")
+{
+    SECTION("convertedOnce")
+    {
+        auto first = "Hello"_wx;
+        auto second = wxUI::literal<"Hello">();
+        CHECK(&first.str() == &second.str());
+        CHECK(&"Hello"_wx.str() != &"World"_wx.str());
+    }
+
+    SECTION("utf8")
+    {
+        CHECK("Unicode 🐨"_wx.str() == wxString::FromUTF8("Unicode 🐨"));
+        CHECK(""_wx.str().empty());
+    }
+
+    SECTION("wxUI_String")
+    {
+        TestParent expected;
+        wxUI::VSizer { wxUI::Text { "Hello" } }.fitTo(&expected);
+        TestParent frame;
+        wxUI::VSizer { wxUI::Text { wxUI::wxUI_String {}, "Hello"_wx } }.fitTo(&frame);
+        CHECK(frame.dump() == expected.dump());
+    }
+
+    SECTION("choices")
+    {
+        TestParent expected;
+        wxUI::VSizer { wxUI::Choice { "Red", "Green" } }.fitTo(&expected);
+        TestParent frame;
+        wxUI::VSizer { wxUI::Choice { "Red"_wx, "Green"_wx } }.fitTo(&frame);
+        CHECK(frame.dump() == expected.dump());
+        TestParent list;
+        wxUI::VSizer { wxUI::Choice { { "Red"_wx, "Green"_wx } } }.fitTo(&list);
+        CHECK(list.dump() == expected.dump());
+    }
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity, misc-use-anonymous-namespace, cppcoreguidelines-avoid-do-while)
@@ -47,6 +47,10 @@ SOFTWARE.
 #error "WXUI_FORWARD_TO_DETAILS leaked from wxUI headers - missing ZapMacros.hpp include"
 #endif
 
+#if defined(WXUI_FORWARD_NOARG_TO_DETAILS)
+#error "WXUI_FORWARD_NOARG_TO_DETAILS leaked from wxUI headers - missing ZapMacros.hpp include"
+#endif
+
 #if defined(WXUI_FORWARD_BIND_TO_DETAILS)
 #error "WXUI_FORWARD_BIND_TO_DETAILS leaked from wxUI headers - missing ZapMacros.hpp include"
 #endif
@@ -53,6 +53,32 @@ struct MenuTypeLookup<wxUI::RadioItem> {
     static constexpr auto name = "radio";
 };
 
+// Appends a plain item, counting how often the description is copied.
+struct CopyCountingItem {
+    explicit CopyCountingItem(int& copies)
+        : copies_(&copies)
+    {
+    }
+    CopyCountingItem(CopyCountingItem const& other)
+        : copies_(other.copies_)
+    {
+        ++*copies_;
+    }
+    CopyCountingItem(CopyCountingItem&&) = default;
+    auto operator=(CopyCountingItem const&) -> CopyCountingItem& = delete;
+    auto operator=(CopyCountingItem&&) -> CopyCountingItem& = delete;
+    ~CopyCountingItem() = default;
+
+    template <typename Frame, typename MenuT>
+    void createAndAdd(Frame& frame, MenuT& menu, int& identity)
+    {
+        wxUI::Item { wxID_EXIT }.createAndAdd(frame, menu, identity);
+    }
+
+private:
+    int* copies_;
+};
+
 template <typename MenuType>
 auto RunMenuTest_id()
 {
@@ -615,6 +641,86 @@ TEST_CASE("Menu")
         CHECK(frame.dump() == std::vector { std::string { "menu:MenuBar:[[title:Menu1:[(menuItem:id=5006,kind=normal,label=\"Quit\",help=\"Quit this program\"),]:numProxyHandles=1,]" } });
     }
 
+    SECTION("menubar.dispatcher")
+    {
+        TestParent frame;
+        auto calls = std::vector<std::string> {};
+        wxUI::MenuBar {
+            wxUI::Menu {
+                "Menu1",
+                wxUI::Item { wxID_EXIT, [&calls] { calls.push_back("exit"); } },
+                wxUI::Item { "Named", [&calls] { calls.push_back("named"); } },
+                wxUI::Menu {
+                    "Menu2",
+                    wxUI::CheckItem { "Checked", [&calls](wxCommandEvent&) { calls.push_back("checked"); } },
+                    wxUI::Item { wxID_OPEN } } }
+        }
+            .withDispatcher()
+            .fitTo(&frame);
+
+        CHECK(frame.log == std::vector<std::string> { "BindMenuDispatcher" });
+        REQUIRE(frame.dispatchMenu);
+        CHECK(frame.dispatchMenu(wxID_EXIT));
+        CHECK(frame.dispatchMenu(wxID_AUTO_LOWEST + 1));
+        CHECK(frame.dispatchMenu(wxID_AUTO_LOWEST));
+        CHECK(!frame.dispatchMenu(wxID_OPEN));
+        CHECK(!frame.dispatchMenu(wxID_AUTO_LOWEST + 2));
+        CHECK(calls == std::vector<std::string> { "exit", "checked", "named" });
+    }
+
+    SECTION("menu.dispatcher.table")
+    {
+        auto calls = std::vector<int> {};
+        auto dispatcher = wxUI::details::MenuDispatcher {};
+        dispatcher.add(wxID_AUTO_LOWEST + 3'000, [&calls] { calls.push_back(1); });
+        dispatcher.add(wxID_EXIT, [&calls] { calls.push_back(2); });
+        dispatcher.add(wxID_EXIT, [&calls] { calls.push_back(3); });
+        CHECK(dispatcher.find(wxID_AUTO_LOWEST + 2'999) == nullptr);
+        CHECK(dispatcher.find(wxID_AUTO_LOWEST + 3'001) == nullptr);
+        CHECK(dispatcher.find(wxID_AUTO_HIGHEST + 1) == nullptr);
+
+        auto event = wxCommandEvent {};
+        CHECK(dispatcher.dispatch(wxID_AUTO_LOWEST + 3'000, event));
+        CHECK(dispatcher.dispatch(wxID_EXIT, event));
+        CHECK(calls == std::vector<int> { 1, 3 });
+
+        auto scopedTo = [] { return wxUI::details::MenuDispatcher::current(); };
+        CHECK(scopedTo() == nullptr);
+        {
+            auto scope = wxUI::details::MenuDispatcher::Scope { &dispatcher };
+            CHECK(scopedTo() == &dispatcher);
+            {
+                auto inner = wxUI::details::MenuDispatcher::Scope { nullptr };
+                CHECK(scopedTo() == nullptr);
+            }
+            CHECK(scopedTo() == &dispatcher);
+        }
+        CHECK(scopedTo() == nullptr);
+    }
+
+    SECTION("menu.moves")
+    {
+        TestParent frame;
+        auto copies = 0;
+        wxUI::MenuBar {
+            wxUI::Menu {
+                "Menu1",
+                wxUI::Menu {
+                    "Menu2",
+                    CopyCountingItem { copies } } }
+                .withProxy(wxUI::MenuProxy {})
+        }
+            .fitTo(&frame);
+        CHECK(copies == 0);
+
+        auto item = CopyCountingItem { copies };
+        auto const menu = wxUI::Menu { "Menu1", item };
+        CHECK(copies == 1);
+        wxUI::MenuBar { menu }.fitTo(&frame);
+        CHECK(copies == 2);
+        static_assert(std::is_same_v<decltype(menu), wxUI::Menu<CopyCountingItem> const>);
+    }
+
     SECTION("menubar.proxy")
     {
         TestParent frame;
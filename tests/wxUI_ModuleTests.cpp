@@ -0,0 +1,70 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <vector>
+#include <wx/wx.h>
+
+import wxUI;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
+
+TEST_CASE("Module")
+{
+    SECTION("descriptions")
+    {
+        auto layout = wxUI::VSizer {
+            wxSizerFlags {}.Border(wxALL, 2),
+            wxUI::Text { "Name" },
+            wxUI::HSizer {
+                wxUI::Button { wxID_OK }.bind([] { }),
+                wxUI::Button { wxID_CANCEL },
+            },
+        };
+        auto menu = wxUI::MenuBar {
+            wxUI::Menu { "&File", wxUI::Item { wxID_EXIT }, wxUI::Separator {} },
+        };
+        static_cast<void>(layout);
+        static_cast<void>(menu);
+    }
+    SECTION("choices")
+    {
+        auto const units = wxUI::ChoiceList { "mm", "cm", "m" };
+        auto const copy = units;
+        CHECK(copy.shares(units));
+        CHECK(units.at(1) == "cm");
+    }
+    SECTION("literals")
+    {
+        using namespace wxUI::literals;
+        CHECK("Quit"_wx.str() == wxString("Quit"));
+        CHECK(&"Quit"_wx.str() == &wxUI::literal<"Quit">().str());
+    }
+    SECTION("version")
+    {
+        CHECK(std::string { wxUI::version.string } == std::string { wxUI::Version::string });
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
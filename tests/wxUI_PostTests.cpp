@@ -0,0 +1,240 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include "TestCustomizations.hpp"
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include <vector>
+#include <wxUI/GetterSetter.hpp>
+#include <wxUI/Proxy.hpp>
+
+#include <wx/wx.h>
+
+using namespace wxUITests;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
+
+namespace {
+// A Proxy with two accessors that record every write, like a control would.
+struct TestProxy : wxUI::details::Proxy<TestParent> {
+    [[nodiscard]] auto value() const
+    {
+        auto* controller = control();
+        return wxUI::details::GetterSetter {
+            controller,
+            [controller] { return controller->value.value_or(0); },
+            [controller](int value) {
+                controller->value = value;
+                controller->log.push_back(std::format("SetValue:{}", value));
+            }
+        };
+    }
+    [[nodiscard]] auto range() const
+    {
+        auto* controller = control();
+        return wxUI::details::GetterSetter {
+            controller,
+            [controller] { return controller->range.value_or(std::pair { 0, 0 }).second; },
+            [controller](int range) {
+                controller->range = std::pair { 0, range };
+                controller->log.push_back(std::format("SetRange:{}", range));
+            }
+        };
+    }
+    void append(std::string_view text) const
+    {
+        auto* controller = control();
+        wxUI::details::applyOrQueueEdit(wxUI::details::writeTarget(controller), [controller, text = std::string { text }] {
+            controller->log.push_back(std::format("AppendText:{}", text));
+        });
+    }
+};
+
+// Runs the drains the posts asked for, as the event loop would.
+auto runEventLoop() -> size_t
+{
+    auto count = size_t {};
+    while (true) {
+        auto wakes = std::vector<std::function<void()>> {};
+        {
+            auto lock = std::scoped_lock { postWakesMutex() };
+            wakes.swap(postWakes());
+        }
+        if (wakes.empty()) {
+            return count;
+        }
+        for (auto& wake : wakes) {
+            wake();
+            ++count;
+        }
+    }
+}
+}
+
+TEST_CASE("Post")
+{
+    TestParent control;
+    auto proxy = TestProxy {};
+    proxy.setUnderlying(&control);
+
+    SECTION("deferred")
+    {
+        wxUI::post(proxy).value() = 1;
+        wxUI::post(proxy).range() = 10;
+        wxUI::post(proxy).value() = 2;
+        CHECK(control.log.empty());
+        CHECK(runEventLoop() == 1);
+        CHECK(control.log == std::vector<std::string> { "SetValue:1", "SetRange:10", "SetValue:2" });
+    }
+    SECTION("onlyWhilePosted")
+    {
+        wxUI::post(proxy).value() = 1;
+        proxy.value() = 2;
+        CHECK(control.log == std::vector<std::string> { "SetValue:2" });
+        runEventLoop();
+        CHECK(control.log == std::vector<std::string> { "SetValue:2", "SetValue:1" });
+    }
+    SECTION("latest")
+    {
+        for (auto i = 0; i < 100; ++i) {
+            wxUI::postLatest(proxy).value() = i;
+            wxUI::postLatest(proxy).range() = i * 10;
+        }
+        wxUI::post(proxy).value() = 1000;
+        CHECK(runEventLoop() == 1);
+        CHECK(control.log == std::vector<std::string> { "SetValue:99", "SetRange:990", "SetValue:1000" });
+    }
+    SECTION("editsNotCoalesced")
+    {
+        wxUI::postLatest(proxy).append("a");
+        wxUI::postLatest(proxy).value() = 1;
+        wxUI::postLatest(proxy).append("b");
+        wxUI::postLatest(proxy).value() = 2;
+        runEventLoop();
+        CHECK(control.log == std::vector<std::string> { "AppendText:a", "AppendText:b", "SetValue:2" });
+    }
+    SECTION("latestPerControl")
+    {
+        TestParent other;
+        auto otherProxy = TestProxy {};
+        otherProxy.setUnderlying(&other);
+        wxUI::postLatest(proxy).value() = 1;
+        wxUI::postLatest(otherProxy).value() = 2;
+        wxUI::postLatest(proxy).value() = 3;
+        runEventLoop();
+        CHECK(control.log == std::vector<std::string> { "SetValue:3" });
+        CHECK(other.log == std::vector<std::string> { "SetValue:2" });
+    }
+    SECTION("heldTogether")
+    {
+        TestParent other;
+        auto otherProxy = TestProxy {};
+        otherProxy.setUnderlying(&other);
+        auto posted = wxUI::postLatest(proxy);
+        auto otherPosted = wxUI::postLatest(otherProxy);
+        posted.value() = 1;
+        otherPosted.value() = 2;
+        posted.range() = 10;
+        otherPosted.range() = 20;
+        CHECK(control.log.empty());
+        CHECK(other.log.empty());
+        runEventLoop();
+        CHECK(control.log == std::vector<std::string> { "SetValue:1", "SetRange:10" });
+        CHECK(other.log == std::vector<std::string> { "SetValue:2", "SetRange:20" });
+    }
+    SECTION("otherControlsWhileHeld")
+    {
+        TestParent other;
+        auto otherProxy = TestProxy {};
+        otherProxy.setUnderlying(&other);
+        auto posted = wxUI::post(proxy);
+        otherProxy.value() = 5;
+        CHECK(other.log == std::vector<std::string> { "SetValue:5" });
+        posted.value() = 1;
+        CHECK(control.log.empty());
+        runEventLoop();
+        CHECK(control.log == std::vector<std::string> { "SetValue:1" });
+    }
+    SECTION("destroyedBeforeDrain")
+    {
+        wxUI::post(proxy).value() = 1;
+        wxUI::post(proxy).append("a");
+        proxy.setUnderlying(nullptr);
+        runEventLoop();
+        CHECK(control.log.empty());
+    }
+    SECTION("destroyedBeforePost")
+    {
+        proxy.setUnderlying(nullptr);
+        wxUI::post(proxy).value() = 1;
+        wxUI::postLatest(proxy).range() = 10;
+        wxUI::post(proxy).append("a");
+        CHECK(runEventLoop() == 0);
+        CHECK(control.log.empty());
+    }
+    SECTION("threads")
+    {
+        constexpr auto kThreads = 4;
+        constexpr auto kWrites = 10'000;
+        auto finished = std::atomic<int> {};
+        auto workers = std::vector<std::thread> {};
+        for (auto thread = 0; thread < kThreads; ++thread) {
+            workers.emplace_back([proxy, &finished] {
+                for (auto i = 0; i < kWrites; ++i) {
+                    wxUI::post(proxy).value() = i;
+                }
+                ++finished;
+            });
+        }
+        // drain while the writers are still going
+        while (finished < kThreads) {
+            runEventLoop();
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        runEventLoop();
+        CHECK(control.log.size() == kThreads * kWrites);
+    }
+    SECTION("threadsLatest")
+    {
+        constexpr auto kThreads = 4;
+        constexpr auto kWrites = 10'000;
+        auto workers = std::vector<std::thread> {};
+        for (auto thread = 0; thread < kThreads; ++thread) {
+            workers.emplace_back([proxy] {
+                for (auto i = 0; i <= kWrites; ++i) {
+                    wxUI::postLatest(proxy).value() = i;
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        runEventLoop();
+        CHECK(control.log == std::vector<std::string> { std::format("SetValue:{}", kWrites) });
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
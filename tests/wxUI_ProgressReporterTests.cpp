@@ -0,0 +1,217 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include "TestCustomizations.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include <vector>
+#include <wxUI/GetterSetter.hpp>
+#include <wxUI/ProgressReporter.hpp>
+#include <wxUI/Proxy.hpp>
+
+#include <wx/wx.h>
+
+using namespace wxUITests;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
+
+namespace {
+// A Proxy with the accessors of a Gauge that records every write.
+struct TestProxy : wxUI::details::Proxy<TestParent> {
+    [[nodiscard]] auto value() const
+    {
+        auto* controller = control();
+        return wxUI::details::GetterSetter {
+            [controller] { return controller->value.value_or(0); },
+            [controller](int value) {
+                controller->value = value;
+                controller->log.push_back(std::format("SetValue:{}", value));
+            }
+        };
+    }
+    [[nodiscard]] auto range() const
+    {
+        auto* controller = control();
+        return wxUI::details::GetterSetter {
+            [controller] { return controller->range.value_or(std::pair { 0, 100 }).second; },
+            [controller](int range) {
+                controller->range = std::pair { 0, range };
+                controller->log.push_back(std::format("SetRange:{}", range));
+            }
+        };
+    }
+};
+
+// Fires the running timer once, as the event loop would.
+auto tick() -> bool
+{
+    auto& timers = samplerTimers();
+    if (timers.empty()) {
+        return false;
+    }
+    auto running = timers.back().tick();
+    if (!running) {
+        timers.clear();
+    }
+    return running;
+}
+}
+
+TEST_CASE("ProgressReporter")
+{
+    samplerTimers().clear();
+    TestParent control;
+    auto proxy = TestProxy {};
+    proxy.setUnderlying(&control);
+
+    SECTION("onlyChanges")
+    {
+        auto reporter = wxUI::ProgressReporter::create(proxy);
+        REQUIRE(samplerTimers().size() == 1);
+        CHECK(tick());
+        CHECK(control.log.empty());
+        reporter.setValue(5);
+        CHECK(tick());
+        CHECK(tick());
+        reporter.setValue(5);
+        CHECK(tick());
+        CHECK(control.log == std::vector<std::string> { "SetValue:5" });
+    }
+    SECTION("coalesces")
+    {
+        auto reporter = wxUI::ProgressReporter::create(proxy);
+        for (auto i = 0; i < 1000; ++i) {
+            reporter.setRange(i * 2);
+            reporter.setValue(i);
+        }
+        CHECK(tick());
+        CHECK(control.log == std::vector<std::string> { "SetRange:1998", "SetValue:999" });
+    }
+    SECTION("finalValue")
+    {
+        {
+            auto reporter = wxUI::ProgressReporter::create(proxy);
+            auto copy = reporter;
+            copy.setValue(100);
+        }
+        CHECK(!tick());
+        CHECK(control.log == std::vector<std::string> { "SetValue:100" });
+
+        auto reporter = wxUI::ProgressReporter::create(proxy);
+        CHECK(samplerTimers().size() == 1);
+    }
+    SECTION("sharedTimer")
+    {
+        TestParent other;
+        auto otherProxy = TestProxy {};
+        otherProxy.setUnderlying(&other);
+        auto reporter = wxUI::ProgressReporter::create(proxy);
+        {
+            auto otherReporter = wxUI::ProgressReporter::create(otherProxy);
+            CHECK(samplerTimers().size() == 1);
+            reporter.setValue(1);
+            otherReporter.setValue(2);
+            CHECK(tick());
+        }
+        CHECK(tick());
+        CHECK(control.log == std::vector<std::string> { "SetValue:1" });
+        CHECK(other.log == std::vector<std::string> { "SetValue:2" });
+    }
+    SECTION("controlDestroyed")
+    {
+        auto reporter = wxUI::ProgressReporter::create(proxy);
+        reporter.setValue(5);
+        proxy.setUnderlying(nullptr);
+        CHECK(!tick());
+        CHECK(control.log.empty());
+        reporter.setValue(6);
+    }
+    SECTION("timerDestroyed")
+    {
+        TestParent other;
+        auto otherProxy = TestProxy {};
+        otherProxy.setUnderlying(&other);
+        auto reporter = wxUI::ProgressReporter::create(proxy);
+        auto otherReporter = wxUI::ProgressReporter::create(otherProxy);
+        REQUIRE(samplerTimers().size() == 1);
+
+        // the window the timer belonged to went away, and the control with it
+        proxy.setUnderlying(nullptr);
+        samplerTimers().front().stopped();
+        samplerTimers().erase(samplerTimers().begin());
+        // the other window's reporter still gets a timer
+        REQUIRE(samplerTimers().size() == 1);
+        reporter.setValue(1);
+        otherReporter.setValue(2);
+        CHECK(tick());
+        CHECK(control.log.empty());
+        CHECK(other.log == std::vector<std::string> { "SetValue:2" });
+
+        // and later ones do not start a second
+        TestParent third;
+        auto thirdProxy = TestProxy {};
+        thirdProxy.setUnderlying(&third);
+        auto thirdReporter = wxUI::ProgressReporter::create(thirdProxy);
+        CHECK(samplerTimers().size() == 1);
+        otherProxy.setUnderlying(nullptr);
+        thirdProxy.setUnderlying(nullptr);
+    }
+    SECTION("sampleRate")
+    {
+        {
+            auto reporter = wxUI::ProgressReporter::create(proxy);
+            CHECK(samplerTimers().back().interval == std::chrono::milliseconds { 33 });
+        }
+        CHECK(!tick());
+        wxUI::ProgressReporter::setSampleRate(10);
+        {
+            auto reporter = wxUI::ProgressReporter::create(proxy);
+            CHECK(samplerTimers().back().interval == std::chrono::milliseconds { 100 });
+        }
+        CHECK(!tick());
+        wxUI::ProgressReporter::setSampleRate(30);
+    }
+    SECTION("threads")
+    {
+        auto reporter = wxUI::ProgressReporter::create(proxy);
+        auto worker = std::thread { [reporter] {
+            reporter.setRange(100'000);
+            for (auto i = 0; i <= 100'000; ++i) {
+                reporter.setValue(i);
+            }
+        } };
+        while (control.value.value_or(0) != 100'000) {
+            tick();
+        }
+        worker.join();
+        CHECK(control.log.size() <= 100'001);
+        CHECK(control.log.back() == "SetValue:100000");
+    }
+
+    // leave nothing running for the next section
+    while (!samplerTimers().empty()) {
+        tick();
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
@@ -0,0 +1,147 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include "TestCustomizations.hpp"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <vector>
+#include <wxUI/Button.hpp>
+#include <wxUI/Layout.hpp>
+#include <wxUI/Prototype.hpp>
+#include <wxUI/Text.hpp>
+
+#include <wx/wx.h>
+
+using namespace wxUITests;
+
+namespace {
+template <typename Layout>
+auto dumpOf(Layout&& layout) -> std::vector<std::string>
+{
+    TestParent frame;
+    std::forward<Layout>(layout).fitTo(&frame);
+    return frame.dump();
+}
+
+auto strip()
+{
+    return wxUI::VSizer { "Channel", wxUI::Text { "Gain" }, wxUI::Button { "Mute" } };
+}
+
+auto lines(std::vector<std::string> const& dump, std::string const& prefix)
+{
+    return std::ranges::count_if(dump, [&prefix](auto const& line) { return line.starts_with(prefix); });
+}
+} // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
+TEST_CASE("Prototype")
+{
+    SECTION("stamp")
+    {
+        auto prototype = wxUI::Prototype { strip() };
+        CHECK(dumpOf(prototype.stamp()) == dumpOf(strip()));
+        CHECK(dumpOf(prototype.stamp()) == dumpOf(strip()));
+    }
+    SECTION("stamp.many")
+    {
+        auto prototype = wxUI::Prototype { strip() };
+        CHECK(dumpOf(wxUI::HSizer { prototype.stamp(), prototype.stamp(), prototype.stamp() }) == dumpOf(wxUI::HSizer { strip(), strip(), strip() }));
+    }
+    SECTION("proxy")
+    {
+        auto mute = wxUI::Button::Proxy {};
+        auto sizer = wxUI::SizerProxy {};
+        auto prototype = wxUI::Prototype { wxUI::VSizer { wxUI::Text { "Gain" }, wxUI::Button { "Mute" }.withProxy(mute) }.withProxy(sizer) };
+        auto first = wxUI::Button::Proxy {};
+        auto second = wxUI::Button::Proxy {};
+        CHECK(dumpOf(prototype.stamp().withProxy(mute, first)) == dumpOf(wxUI::VSizer { wxUI::Text { "Gain" }, wxUI::Button { "Mute" }.withProxy(first) }.withProxy(sizer)));
+        CHECK(dumpOf(prototype.stamp().withProxy(mute, second).withProxy(sizer, wxUI::SizerProxy {})) == dumpOf(wxUI::VSizer { wxUI::Text { "Gain" }, wxUI::Button { "Mute" }.withProxy(second) }.withProxy(sizer)));
+
+
+        // each copy binds its own proxies, and the prototype's only where it has none
+        boundProxies().clear();
+        auto secondSizer = wxUI::SizerProxy {};
+        dumpOf(wxUI::HSizer { prototype.stamp().withProxy(mute, first), prototype.stamp().withProxy(mute, second).withProxy(sizer, secondSizer) });
+        auto bound = [](auto const& proxy) { return std::ranges::count(boundProxies(), proxy.identity()); };
+        CHECK(bound(first) == 1);
+        CHECK(bound(second) == 1);
+        CHECK(bound(mute) == 0);
+        CHECK(bound(secondSizer) == 1);
+        CHECK(bound(sizer) == 1);
+    }
+    SECTION("proxy.redirect")
+    {
+        auto cache = wxUI::details::PrototypeCache {};
+        auto mute = wxUI::Button::Proxy {};
+        auto other = wxUI::Button::Proxy {};
+        auto first = wxUI::Button::Proxy {};
+        auto redirects = std::vector<wxUI::details::ProxyRedirect> { { mute.identity(), wxUI::details::Proxy<wxButton> { first } } };
+        CHECK(&wxUI::details::PrototypeScope::proxyFor<wxButton>(mute) == &mute);
+        {
+            auto scope = wxUI::details::PrototypeScope { cache, redirects };
+            CHECK(wxUI::details::PrototypeScope::proxyFor<wxButton>(mute).identity() == first.identity());
+            CHECK(&wxUI::details::PrototypeScope::proxyFor<wxButton>(other) == &other);
+            // a copy stamped while creating another still sees the outer redirects
+            auto innerCache = wxUI::details::PrototypeCache {};
+            auto innerRedirects = std::vector<wxUI::details::ProxyRedirect> {};
+            auto inner = wxUI::details::PrototypeScope { innerCache, innerRedirects };
+            CHECK(wxUI::details::PrototypeScope::proxyFor<wxButton>(mute).identity() == first.identity());
+        }
+        CHECK(&wxUI::details::PrototypeScope::proxyFor<wxButton>(mute) == &mute);
+    }
+    SECTION("bestSizes")
+    {
+        auto prototype = wxUI::Prototype { strip() };
+        auto dump = dumpOf(prototype.stamp());
+        CHECK(lines(dump, "GetBestSize") == 0);
+        CHECK(lines(dump, "SetMinSize") == 0);
+    }
+    SECTION("bestSizes.reused")
+    {
+        auto prototype = wxUI::Prototype { strip() }.withBestSizesReused();
+        auto first = dumpOf(prototype.stamp());
+        CHECK(lines(first, "GetBestSize") == 2);
+        CHECK(lines(first, "SetMinSize") == 0);
+        auto second = dumpOf(prototype.stamp());
+        CHECK(lines(second, "GetBestSize") == 0);
+        CHECK(std::ranges::count(second, "SetMinSize:(32,20)") == 2);
+    }
+    SECTION("bestSizes.notReused")
+    {
+        auto cache = wxUI::details::PrototypeCache {};
+        auto redirects = std::vector<wxUI::details::ProxyRedirect> {};
+        wxUI::details::PrototypeScope { cache, redirects }.finish();
+        CHECK(!cache.measured);
+        cache.reuseBestSizes = true;
+        wxUI::details::PrototypeScope { cache, redirects }.finish();
+        CHECK(cache.measured);
+    }
+    SECTION("fonts")
+    {
+        auto prototype = wxUI::Prototype { wxUI::VSizer { wxUI::Text { "Gain" }.withFont(wxFontInfo(12)) } };
+        CHECK(dumpOf(prototype.stamp()) == dumpOf(wxUI::VSizer { wxUI::Text { "Gain" }.withFont(wxFontInfo(12)) }));
+    }
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
@@ -0,0 +1,72 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+// Checks that each controller takes up no more than its budget, so that
+// descriptions stay cheap to copy and move.  Growing a controller means
+// raising its budget here in the same change.
+//
+// The budgets were measured on 64-bit builds with a 48-byte wxString and a
+// std::function of at most 64 bytes, as in release builds with libstdc++,
+// libc++ and MSVC.  Other configurations, such as MSVC's iterator debugging,
+// make every string and vector larger, so they are not checked.
+
+#include <wxUI/wxUI.hpp>
+
+#include <functional>
+#include <vector>
+
+namespace {
+constexpr auto kMeasuredConfiguration = sizeof(void*) == 8
+    && sizeof(wxString) <= 48
+    && sizeof(std::function<void()>) <= 64
+    && sizeof(std::vector<int>) <= 24;
+}
+
+#define WXUI_TEST_SIZE_BUDGET(WIDGET, BYTES) \
+    static_assert(!kMeasuredConfiguration || sizeof(wxUI::WIDGET) <= (BYTES), #WIDGET " is over its size budget")
+
+// Most controllers only set an id, a style and perhaps flags, so that is all
+// WidgetDetails, which every controller holds, keeps inline.
+static_assert(!kMeasuredConfiguration || sizeof(wxUI::details::WidgetDetails<void, wxWindow>) <= 48, "WidgetDetails is over its size budget");
+
+WXUI_TEST_SIZE_BUDGET(Bitmap, 48);
+WXUI_TEST_SIZE_BUDGET(BitmapButton, 56);
+WXUI_TEST_SIZE_BUDGET(BitmapComboBox, 80);
+WXUI_TEST_SIZE_BUDGET(BitmapToggleButton, 64);
+WXUI_TEST_SIZE_BUDGET(Button, 96);
+WXUI_TEST_SIZE_BUDGET(CalendarCtrl, 48);
+WXUI_TEST_SIZE_BUDGET(CheckBox, 96);
+WXUI_TEST_SIZE_BUDGET(Choice, 64);
+WXUI_TEST_SIZE_BUDGET(ColorPickerCtrl, 72);
+WXUI_TEST_SIZE_BUDGET(ComboBox, 64);
+WXUI_TEST_SIZE_BUDGET(Gauge, 48);
+WXUI_TEST_SIZE_BUDGET(Hyperlink, 136);
+WXUI_TEST_SIZE_BUDGET(Line, 40);
+WXUI_TEST_SIZE_BUDGET(ListBox, 88);
+WXUI_TEST_SIZE_BUDGET(RadioBox, 112);
+WXUI_TEST_SIZE_BUDGET(Slider, 64);
+WXUI_TEST_SIZE_BUDGET(SpinCtrl, 64);
+WXUI_TEST_SIZE_BUDGET(Text, 96);
+WXUI_TEST_SIZE_BUDGET(TextCtrl, 88);
+WXUI_TEST_SIZE_BUDGET(VirtualListBox, 136);
@@ -25,6 +25,7 @@ SOFTWARE.
 #include <catch2/catch_test_macros.hpp>
 #include <wxUI/Layout.hpp>
 #include <wxUI/TextCtrl.hpp>
+#include <wxUI/Transaction.hpp>
 #include <wxUI/wxUITypes.hpp>
 
 #include <wx/wx.h>
@@ -45,6 +46,9 @@ struct TextCtrlTestPolicy {
     static auto expectedSize() { return testSize(); }
 };
 static auto createUUT() { return TextCtrlTestPolicy::createUUT(); }
+static_assert(std::is_same_v<decltype(std::declval<TypeUnderTest::Proxy const&>().log()), wxUI::TextLog>);
+static_assert(std::is_same_v<decltype(std::declval<TypeUnderTest::Proxy const&>().range(0, 1)), std::string>);
+static_assert(std::is_same_v<decltype(std::declval<TypeUnderTest::Proxy const&>().line(0)), std::string>);
 
 namespace {
 using Dump = std::vector<std::string>;
@@ -175,4 +179,48 @@ TEST_CASE("TextCtrl")
 
     COMMON_TESTS(TextCtrlTestPolicy)
 }
+
+TEST_CASE("TextCtrl::Proxy")
+{
+    TestParent control;
+    control.text = "one\ntwo\nthree";
+    auto proxy = wxUI::details::TextCtrlProxy<TestParent> {};
+    proxy.setUnderlying(&control);
+
+    SECTION("reads")
+    {
+        CHECK(proxy.length() == 13);
+        CHECK(proxy.lineCount() == 3);
+        CHECK(proxy.range(4, 7) == "two");
+        CHECK(proxy.line(0) == "one");
+        CHECK(proxy.line(2) == "three");
+        CHECK(control.log.empty());
+    }
+    SECTION("edits")
+    {
+        proxy.insert(0, ">");
+        proxy.replace(5, 8, "2");
+        proxy.append("\nfour");
+        CHECK(control.text == ">one\n2\nthree\nfour");
+        CHECK(control.log == Dump { "Replace:0:0:>", "Replace:5:8:2", "AppendText:\nfour" });
+        CHECK(proxy.lineCount() == 4);
+        CHECK(proxy.line(3) == "four");
+    }
+    SECTION("editsInTransaction")
+    {
+        TestParent frame;
+        control.parentWindow = &frame;
+        {
+            auto transaction = wxUI::Transaction { &frame };
+            proxy.insert(0, ">");
+            proxy.append("!");
+            proxy.replace(1, 4, "1");
+            CHECK(control.log.empty());
+            CHECK(proxy.length() == 13);
+        }
+        CHECK(control.log == Dump { "Replace:0:0:>", "AppendText:!", "Replace:1:4:1" });
+        CHECK(control.text == ">1\ntwo\nthree!");
+    }
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity, misc-use-anonymous-namespace, cppcoreguidelines-avoid-do-while)
@@ -0,0 +1,161 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include "TestCustomizations.hpp"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <vector>
+#include <wxUI/Button.hpp>
+#include <wxUI/Layout.hpp>
+#include <wxUI/Text.hpp>
+#include <wxUI/TextExtentCache.hpp>
+
+#include <wx/wx.h>
+
+using namespace wxUITests;
+
+namespace {
+auto lines(std::vector<std::string> const& dump, std::string const& prefix)
+{
+    return std::ranges::count_if(dump, [&prefix](auto const& line) { return line.starts_with(prefix); });
+}
+} // namespace
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
+TEST_CASE("TextExtentCache")
+{
+    auto& cache = wxUI::TextExtentCache::instance();
+    cache.clear();
+
+    SECTION("measured.once")
+    {
+        TestParent frame;
+        frame.dpiScale = 1.0;
+        wxUI::VSizer { wxUI::Text { "Gain" }, wxUI::Text { "Gain" }, wxUI::Text { "Pan" } }.fitTo(&frame);
+        auto dump = frame.dump();
+        CHECK(lines(dump, "GetBestSize") == 2);
+        CHECK(lines(dump, "UseTextExtent:(32,20)") == 1);
+        CHECK(lines(dump, "Create:wxStaticText[id=-1, pos=(-1,-1), size=(32,20), style=0, text=\"Gain\"]") == 1);
+        CHECK(cache.size() == 2);
+    }
+
+    SECTION("measured.once.across.layouts")
+    {
+        TestParent first;
+        first.dpiScale = 1.0;
+        wxUI::VSizer { wxUI::Text { "Gain" } }.fitTo(&first);
+        TestParent second;
+        second.dpiScale = 1.0;
+        wxUI::VSizer { wxUI::Text { "Gain" } }.fitTo(&second);
+        CHECK(lines(first.dump(), "GetBestSize") == 1);
+        CHECK(lines(second.dump(), "GetBestSize") == 0);
+        CHECK(lines(second.dump(), "UseTextExtent:(32,20)") == 1);
+    }
+
+    SECTION("kind.style.wrap")
+    {
+        TestParent frame;
+        frame.dpiScale = 1.0;
+        wxUI::VSizer {
+            wxUI::Text { "Gain" },
+            wxUI::Button { "Gain" },
+            wxUI::Text { "Gain" }.withStyle(wxALIGN_RIGHT),
+            wxUI::Text { "Gain" }.withWrap(40),
+        }
+            .fitTo(&frame);
+        CHECK(lines(frame.dump(), "GetBestSize") == 4);
+        CHECK(lines(frame.dump(), "UseTextExtent") == 0);
+        CHECK(cache.size() == 4);
+    }
+
+    SECTION("font.change")
+    {
+        TestParent frame;
+        frame.dpiScale = 1.0;
+        wxUI::VSizer { wxUI::Text { "Gain" } }.fitTo(&frame);
+        TestParent bigger;
+        bigger.dpiScale = 1.0;
+        bigger.fontDescription = "Sans 12";
+        wxUI::VSizer { wxUI::Text { "Gain" } }.fitTo(&bigger);
+        CHECK(lines(bigger.dump(), "GetBestSize") == 1);
+        CHECK(lines(bigger.dump(), "UseTextExtent") == 0);
+    }
+
+    SECTION("dpi.change")
+    {
+        TestParent frame;
+        frame.dpiScale = 1.0;
+        wxUI::VSizer { wxUI::Text { "Gain" } }.fitTo(&frame);
+        TestParent scaled;
+        scaled.dpiScale = 2.0;
+        wxUI::VSizer { wxUI::Text { "Gain" } }.fitTo(&scaled);
+        CHECK(lines(scaled.dump(), "GetBestSize") == 1);
+        CHECK(lines(scaled.dump(), "UseTextExtent") == 0);
+    }
+
+    SECTION("own.size")
+    {
+        TestParent frame;
+        frame.dpiScale = 1.0;
+        wxUI::VSizer { wxUI::Text { "Gain" }.withSize({ 50, 10 }), wxUI::Text { "Gain" }.withSize({ 50, 10 }) }.fitTo(&frame);
+        CHECK(lines(frame.dump(), "GetBestSize") == 0);
+        CHECK(cache.size() == 0);
+    }
+
+    SECTION("default.button")
+    {
+        TestParent frame;
+        frame.dpiScale = 1.0;
+        wxUI::VSizer { wxUI::Button { "OK" }.setDefault(), wxUI::Button { "OK" }.setDefault() }.fitTo(&frame);
+        CHECK(lines(frame.dump(), "UseTextExtent") == 0);
+        CHECK(cache.size() == 0);
+    }
+
+    SECTION("clear")
+    {
+        TestParent frame;
+        frame.dpiScale = 1.0;
+        wxUI::VSizer { wxUI::Text { "Gain" } }.fitTo(&frame);
+        cache.clear();
+        TestParent again;
+        again.dpiScale = 1.0;
+        wxUI::VSizer { wxUI::Text { "Gain" } }.fitTo(&again);
+        CHECK(lines(again.dump(), "GetBestSize") == 1);
+        CHECK(cache.size() == 1);
+    }
+
+    SECTION("full")
+    {
+        TestParent frame;
+        frame.dpiScale = 1.0;
+        auto* sizer = frame.add(TestSizer { .type = SizerType::Box, .orientation = wxVERTICAL });
+        for (auto index = std::size_t {}; index < wxUI::TextExtentCache::kMaxEntries; ++index) {
+            wxUI::Text { std::to_string(index) }.createAndAdd(&frame, sizer, wxSizerFlags {});
+        }
+        CHECK(cache.size() == wxUI::TextExtentCache::kMaxEntries);
+        wxUI::VSizer { wxUI::Text { "Gain" } }.fitTo(&frame);
+        CHECK(cache.size() == 1);
+    }
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
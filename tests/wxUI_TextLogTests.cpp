@@ -0,0 +1,218 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include "TestCustomizations.hpp"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <thread>
+#include <vector>
+#include <wxUI/GetterSetter.hpp>
+#include <wxUI/Proxy.hpp>
+#include <wxUI/TextLog.hpp>
+
+#include <wx/wx.h>
+
+using namespace wxUITests;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
+
+namespace {
+// A Proxy with the label accessor of a TextCtrl.
+struct TestProxy : wxUI::details::Proxy<TestParent> {
+    [[nodiscard]] auto label() const
+    {
+        auto* controller = control();
+        return wxUI::details::GetterSetter {
+            [controller] { return controller->text.value_or(""); },
+            [controller](std::string const& label) { controller->text = label; }
+        };
+    }
+};
+
+// Fires the running timer once, as the event loop would.
+auto tick() -> bool
+{
+    auto& timers = samplerTimers();
+    if (timers.empty()) {
+        return false;
+    }
+    auto running = timers.back().tick();
+    if (!running) {
+        timers.clear();
+    }
+    return running;
+}
+
+auto makeLog(TestProxy const& proxy, size_t maxLines, size_t maxBytes = 0)
+{
+    return wxUI::TextLog::create(proxy, { .maxLines = maxLines, .maxBytes = maxBytes });
+}
+}
+
+TEST_CASE("TextLog")
+{
+    samplerTimers().clear();
+    TestParent control;
+    auto proxy = TestProxy {};
+    proxy.setUnderlying(&control);
+
+    SECTION("flushesOnTick")
+    {
+        control.text = "hi\n";
+        auto log = makeLog(proxy, 100);
+        log.append("a");
+        log.appendLine("b");
+        log.appendLine("c");
+        CHECK(control.log.empty());
+        CHECK(tick());
+        CHECK(tick());
+        CHECK(control.log == std::vector<std::string> { "AppendText:ab\nc\n" });
+        CHECK(control.text == "hi\nab\nc\n");
+    }
+    SECTION("maxLines")
+    {
+        control.text = "1\n2\n";
+        auto log = makeLog(proxy, 3);
+        log.appendLine("3");
+        log.appendLine("4");
+        log.appendLine("5");
+        tick();
+        CHECK(control.log == std::vector<std::string> { "RemoveLines:2", "AppendText:3\n4\n5\n" });
+        log.appendLine("6");
+        tick();
+        CHECK(control.text == "4\n5\n6\n");
+    }
+    SECTION("preTrim")
+    {
+        auto log = makeLog(proxy, 2);
+        for (auto i = 0; i < 1000; ++i) {
+            log.appendLine(std::to_string(i));
+        }
+        tick();
+        CHECK(control.log == std::vector<std::string> { "AppendText:998\n999\n" });
+    }
+    SECTION("maxBytes")
+    {
+        auto log = makeLog(proxy, 0, 10);
+        log.appendLine("12345");
+        tick();
+        log.appendLine("678");
+        tick();
+        log.appendLine("9");
+        tick();
+        CHECK(control.log == std::vector<std::string> { "AppendText:12345\n", "AppendText:678\n", "RemoveLines:1", "AppendText:9\n" });
+        CHECK(control.text == "678\n9\n");
+    }
+    SECTION("partialLines")
+    {
+        auto log = makeLog(proxy, 2);
+        log.append("a");
+        tick();
+        log.append("b\nc");
+        tick();
+        log.append("\nd\n");
+        tick();
+        CHECK(control.log == std::vector<std::string> { "AppendText:a", "AppendText:b\nc", "RemoveLines:1", "AppendText:\nd\n" });
+        CHECK(control.text == "c\nd\n");
+    }
+    SECTION("mergedLineTrimmed")
+    {
+        control.text = "ab";
+        auto log = makeLog(proxy, 0, 3);
+        log.append("c\nd");
+        tick();
+        CHECK(control.log == std::vector<std::string> { "RemoveLines:1", "AppendText:d" });
+        CHECK(control.text == "d");
+    }
+    SECTION("partialLineKept")
+    {
+        control.text = "ab";
+        auto log = makeLog(proxy, 2);
+        log.append("c\n1\n2\n3\n");
+        tick();
+        CHECK(control.log == std::vector<std::string> { "RemoveLines:1", "AppendText:2\n3\n" });
+        CHECK(control.text == "2\n3\n");
+    }
+    SECTION("pendingBounded")
+    {
+        auto state = wxUI::details::TextLogState { 2, 0 };
+        state.append("partial");
+        for (auto i = 0; i < 1000; ++i) {
+            state.append(std::format("{}\n", i));
+        }
+        CHECK(state.pendingLines <= 4);
+        CHECK(state.pending.starts_with("partial0\n"));
+        CHECK(state.pending.ends_with("998\n999\n"));
+        CHECK(state.take().size() < 30);
+        CHECK(state.pending.empty());
+    }
+    SECTION("controlDestroyed")
+    {
+        auto log = makeLog(proxy, 10);
+        log.appendLine("gone");
+        proxy.setUnderlying(nullptr);
+        CHECK(!tick());
+        CHECK(control.log.empty());
+        log.appendLine("ignored");
+    }
+    SECTION("finished")
+    {
+        {
+            auto log = makeLog(proxy, 10);
+            log.appendLine("last");
+        }
+        CHECK(!tick());
+        CHECK(control.text == "last\n");
+    }
+    SECTION("threads")
+    {
+        constexpr auto kThreads = 4;
+        constexpr auto kLines = 10'000;
+        auto log = makeLog(proxy, 100);
+        auto workers = std::vector<std::thread> {};
+        for (auto thread = 0; thread < kThreads; ++thread) {
+            workers.emplace_back([log, thread] {
+                for (auto i = 0; i < kLines; ++i) {
+                    log.appendLine(std::format("{}:{}", thread, i));
+                }
+            });
+        }
+        while (std::ranges::count(control.text.value_or(""), ':') < 100) {
+            tick();
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        tick();
+        auto text = control.text.value_or("");
+        CHECK(std::ranges::count(text, '\n') == 100);
+        CHECK(text.ends_with(std::format(":{}\n", kLines - 1)));
+    }
+
+    // leave nothing running for the next section
+    while (!samplerTimers().empty()) {
+        tick();
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
@@ -0,0 +1,267 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include "TestCustomizations.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+#include <wxUI/GetterSetter.hpp>
+#include <wxUI/Proxy.hpp>
+#include <wxUI/Transaction.hpp>
+
+#include <wx/wx.h>
+
+using namespace wxUITests;
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
+
+namespace {
+// A field that records every value written to it, like a control in
+// `window` would.
+struct Field {
+    explicit Field(TestParent* window = nullptr, int value = 0)
+        : value(value)
+    {
+        control.parentWindow = window;
+    }
+
+    TestParent control {};
+    int value {};
+    std::vector<int> writes {};
+
+    auto accessor()
+    {
+        return wxUI::details::GetterSetter {
+            &control,
+            [this] { return value; },
+            [this](int newValue) {
+                value = newValue;
+                writes.push_back(newValue);
+            }
+        };
+    }
+};
+
+auto kCaseOneUpdate = std::vector<std::string> {
+    "Freeze",
+    "Layout",
+    "Thaw",
+    "Refresh",
+};
+}
+
+TEST_CASE("Transaction")
+{
+    SECTION("noTransaction")
+    {
+        auto field = Field {};
+        field.accessor() = 1;
+        CHECK(field.value == 1);
+    }
+    SECTION("writesAreQueued")
+    {
+        TestParent frame;
+        auto first = Field { &frame };
+        auto second = Field { &frame };
+        {
+            auto transaction = wxUI::Transaction { &frame };
+            first.accessor() = 1;
+            second.accessor() = 2;
+            first.accessor() = 3;
+            CHECK(first.writes.empty());
+            CHECK(second.writes.empty());
+            CHECK(frame.dump().empty());
+        }
+        CHECK(first.writes == std::vector { 1, 3 });
+        CHECK(second.writes == std::vector { 2 });
+        CHECK(frame.dump() == kCaseOneUpdate);
+    }
+    SECTION("compoundAssignment")
+    {
+        TestParent frame;
+        auto field = Field { &frame, 5 };
+        auto other = Field { &frame, 10 };
+        {
+            auto transaction = wxUI::Transaction { &frame };
+            auto accessor = field.accessor();
+            accessor += 1;
+            accessor += 1;
+            CHECK(accessor.get() == 5);
+            CHECK(accessor++ == 7);
+            --other.accessor();
+        }
+        CHECK(field.writes == std::vector { 6, 7, 8 });
+        CHECK(other.writes == std::vector { 9 });
+    }
+    SECTION("commit")
+    {
+        TestParent frame;
+        auto field = Field { &frame };
+        {
+            auto transaction = wxUI::Transaction { &frame };
+            field.accessor() = 1;
+            transaction.commit();
+            CHECK(field.writes == std::vector { 1 });
+            field.accessor() = 2;
+            CHECK(field.writes == std::vector { 1, 2 });
+            field.accessor() += 1;
+            CHECK(field.writes == std::vector { 1, 2, 3 });
+        }
+        CHECK(frame.dump() == kCaseOneUpdate);
+    }
+    SECTION("empty")
+    {
+        TestParent frame;
+        {
+            auto transaction = wxUI::Transaction { &frame };
+        }
+        CHECK(frame.dump().empty());
+    }
+    SECTION("otherWindow")
+    {
+        TestParent frame;
+        TestParent other;
+        auto field = Field { &other };
+        {
+            auto transaction = wxUI::Transaction { &frame };
+            field.accessor() = 1;
+            CHECK(field.writes == std::vector { 1 });
+        }
+        CHECK(frame.dump().empty());
+    }
+    SECTION("nested")
+    {
+        TestParent frame;
+        TestParent inner;
+        auto outerField = Field { &frame };
+        auto innerField = Field { &inner };
+        {
+            auto transaction = wxUI::Transaction { &frame };
+            {
+                auto nested = wxUI::Transaction { &inner };
+                innerField.accessor() = 1;
+                outerField.accessor() = 2;
+                CHECK(innerField.writes.empty());
+            }
+            CHECK(innerField.writes == std::vector { 1 });
+            CHECK(inner.dump() == kCaseOneUpdate);
+            CHECK(outerField.writes.empty());
+        }
+        CHECK(outerField.writes == std::vector { 2 });
+        CHECK(frame.dump() == kCaseOneUpdate);
+    }
+    SECTION("nested.childWindow")
+    {
+        TestParent frame;
+        auto* panel = frame.add(TestParent { .type = "wxPanel" });
+        frame.log.clear();
+        auto frameField = Field { &frame };
+        auto panelField = Field { panel };
+        {
+            auto transaction = wxUI::Transaction { &frame };
+            {
+                auto nested = wxUI::Transaction { panel };
+                panelField.accessor() = 1;
+                frameField.accessor() = 2;
+            }
+            CHECK(panelField.writes == std::vector { 1 });
+            CHECK(panel->dump() == kCaseOneUpdate);
+            CHECK(frameField.writes.empty());
+            panelField.accessor() = 3;
+            CHECK(panelField.writes == std::vector { 1 });
+        }
+        CHECK(panelField.writes == std::vector { 1, 3 });
+        CHECK(frameField.writes == std::vector { 2 });
+        CHECK(frame.log == kCaseOneUpdate);
+    }
+    SECTION("exception")
+    {
+        TestParent frame;
+        auto field = Field { &frame };
+        try {
+            auto transaction = wxUI::Transaction { &frame };
+            field.accessor() = 1;
+            throw std::runtime_error("abandon");
+        } catch (std::runtime_error const&) {
+        }
+        CHECK(field.writes.empty());
+        CHECK(frame.dump().empty());
+        field.accessor() = 2;
+        CHECK(field.writes == std::vector { 2 });
+    }
+    SECTION("throwingWrite")
+    {
+        TestParent frame;
+        auto field = Field { &frame };
+        auto failing = wxUI::details::GetterSetter {
+            &field.control,
+            [] { return 0; },
+            [](int) { throw std::runtime_error("write failed"); }
+        };
+        {
+            auto transaction = wxUI::Transaction { &frame };
+            field.accessor() = 1;
+            failing = 2;
+            field.accessor() = 3;
+            CHECK_THROWS_AS(transaction.commit(), std::runtime_error);
+            CHECK(field.writes == std::vector { 1 });
+            CHECK(frame.dump() == std::vector<std::string> { "Freeze", "Thaw" });
+            field.accessor() = 4;
+            CHECK(field.writes == std::vector { 1, 4 });
+        }
+    }
+    SECTION("whilePosting")
+    {
+        TestParent frame;
+        TestParent target;
+        auto field = Field { &frame };
+        auto proxy = wxUI::details::Proxy<TestParent> {};
+        proxy.setUnderlying(&target);
+        {
+            auto posted = wxUI::post(proxy);
+            auto transaction = wxUI::Transaction { &frame };
+            field.accessor() = 1;
+            CHECK(field.writes.empty());
+        }
+        CHECK(field.writes == std::vector { 1 });
+        CHECK(frame.dump() == kCaseOneUpdate);
+        auto lock = std::scoped_lock { postWakesMutex() };
+        CHECK(postWakes().empty());
+    }
+    SECTION("bool")
+    {
+        TestParent frame;
+        auto flag = false;
+        auto accessor = wxUI::details::GetterSetter {
+            [&flag] { return flag; },
+            [&flag](bool value) { flag = value; }
+        };
+        {
+            auto transaction = wxUI::Transaction { &frame };
+            accessor = true;
+            CHECK(!flag);
+        }
+        CHECK(flag);
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
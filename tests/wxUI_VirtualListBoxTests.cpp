@@ -0,0 +1,227 @@
+/*
+MIT License
+
+Copyright (c) 2022-2026 Richard Powell
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+#include "wxUI_TestControlCommon.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <wxUI/Layout.hpp>
+#include <wxUI/VirtualListBox.hpp>
+
+#include <wx/wx.h>
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)
+using TypeUnderTest = wxUI::VirtualListBox;
+using namespace wxUITests;
+
+namespace {
+auto rowName(size_t row) -> std::string
+{
+    return std::format("Row {}", row);
+}
+}
+
+struct VirtualListBoxTestPolicy {
+    using TypeUnderTest = wxUI::VirtualListBox;
+    static auto createUUT() { return TypeUnderTest { 3, rowName }; }
+    static auto testStyle() { return wxLB_MULTIPLE; }
+    static auto testPosition() { return wxPoint { 1, 2 }; }
+    static auto testSize() { return wxSize { 10, 12 }; }
+    static auto expectedStyle() { return testStyle(); }
+    static auto expectedPosition() { return testPosition(); }
+    static auto expectedSize() { return testSize(); }
+};
+static auto createUUT() { return VirtualListBoxTestPolicy::createUUT(); }
+
+namespace {
+using Dump = std::vector<std::string>;
+
+Dump testDump(
+    int identity,
+    wxPoint pos,
+    wxSize size,
+    int style,
+    size_t count,
+    const std::vector<int>& selection)
+{
+    auto controller = std::format("wxVListBox[id={}, pos=({},{}), size=({},{}), style={}, count={}]", identity, pos.x, pos.y, size.x, size.y, style, count);
+    std::vector<std::string> results = {
+        "Create:Sizer[orientation=wxVERTICAL]",
+        "Create:" + controller,
+        "topsizer:Sizer[orientation=wxVERTICAL]",
+        "controller:" + controller,
+    };
+    for (const auto& sel : selection) {
+        results.push_back(std::format("{}:{}", (style & wxLB_MULTIPLE) ? "Select" : "SetSelection", sel));
+    }
+    results.push_back("SetEnabled:true");
+    results.push_back("sizer:Sizer[orientation=wxVERTICAL]");
+    results.push_back("Add:" + controller + ":flags:(0,0x0,0)");
+    results.push_back("SetSizeHints:[id=0, pos=(0,0), size=(0,0), style=0]");
+    return results;
+}
+
+auto rowText(TestParent const& frame, size_t row) -> std::string
+{
+    return frame.parents.front().rowText(row).utf8_string();
+}
+}
+
+TEST_CASE("VirtualListBox")
+{
+    SECTION("generator")
+    {
+        TestParent frame;
+        wxUI::VSizer {
+            createUUT()
+        }
+            .fitTo(&frame);
+        CHECK(frame.dump() == testDump(-1, { -1, -1 }, { -1, -1 }, 0, 3, {}));
+        CHECK(rowText(frame, 2) == "Row 2");
+    }
+
+    SECTION("generator.only_called_for_requested_rows")
+    {
+        TestParent frame;
+        auto calls = 0;
+        wxUI::VSizer {
+            TypeUnderTest { 1'000'000, [&calls](size_t row) {
+                               ++calls;
+                               return rowName(row);
+                           } }
+        }
+            .fitTo(&frame);
+        CHECK(frame.dump() == testDump(-1, { -1, -1 }, { -1, -1 }, 0, 1'000'000, {}));
+        CHECK(calls == 0);
+        CHECK(rowText(frame, 999'999) == "Row 999999");
+        CHECK(calls == 1);
+    }
+
+    SECTION("generator.wxString")
+    {
+        TestParent frame;
+        wxUI::VSizer {
+            TypeUnderTest { 2, [](size_t) { return wxString::FromUTF8("Hello 🐨"); } }
+        }
+            .fitTo(&frame);
+        CHECK(rowText(frame, 1) == "Hello 🐨");
+    }
+
+    SECTION("range")
+    {
+        TestParent frame;
+        auto rows = std::vector<std::string> { "Hello 🐨", "Goodbye" };
+        wxUI::VSizer {
+            TypeUnderTest { rows }
+        }
+            .fitTo(&frame);
+        CHECK(frame.dump() == testDump(-1, { -1, -1 }, { -1, -1 }, 0, 2, {}));
+        CHECK(rowText(frame, 0) == "Hello 🐨");
+        rows[0] = "Changed";
+        CHECK(rowText(frame, 0) == "Changed");
+    }
+
+    SECTION("range.owned")
+    {
+        TestParent frame;
+        wxUI::VSizer {
+            TypeUnderTest { std::vector<std::string> { "Hello 🐨", "Goodbye" } }
+        }
+            .fitTo(&frame);
+        CHECK(frame.dump() == testDump(-1, { -1, -1 }, { -1, -1 }, 0, 2, {}));
+        CHECK(rowText(frame, 1) == "Goodbye");
+    }
+
+    SECTION("range.view")
+    {
+        TestParent frame;
+        auto rows = std::vector<char const*> { "zero", "one", "two", "three" };
+        wxUI::VSizer {
+            TypeUnderTest { rows | std::views::reverse }
+        }
+            .fitTo(&frame);
+        CHECK(frame.dump() == testDump(-1, { -1, -1 }, { -1, -1 }, 0, 4, {}));
+        CHECK(rowText(frame, 0) == "three");
+    }
+
+    SECTION("id")
+    {
+        TestParent frame;
+        wxUI::VSizer {
+            TypeUnderTest { 10000, 3, rowName }
+        }
+            .fitTo(&frame);
+        CHECK(frame.dump() == testDump(10000, { -1, -1 }, { -1, -1 }, 0, 3, {}));
+    }
+
+    SECTION("id.range")
+    {
+        TestParent frame;
+        wxUI::VSizer {
+            TypeUnderTest { 10000, std::vector<std::string> { "Hello 🐨", "Goodbye" } }
+        }
+            .fitTo(&frame);
+        CHECK(frame.dump() == testDump(10000, { -1, -1 }, { -1, -1 }, 0, 2, {}));
+    }
+
+    SECTION("setSelection")
+    {
+        TestParent frame;
+        wxUI::VSizer {
+            createUUT().withSelection(1)
+        }
+            .fitTo(&frame);
+        CHECK(frame.dump() == testDump(-1, { -1, -1 }, { -1, -1 }, 0, 3, { 1 }));
+    }
+
+    SECTION("setSelections")
+    {
+        TestParent frame;
+        wxUI::VSizer {
+            createUUT().withStyle(wxLB_MULTIPLE).withSelections({ 0, 2 })
+        }
+            .fitTo(&frame);
+        CHECK(frame.dump() == testDump(-1, { -1, -1 }, { -1, -1 }, 64, 3, { 0, 2 }));
+    }
+
+    SECTION("setSelections.extended")
+    {
+        TestParent frame;
+        wxUI::VSizer {
+            createUUT().withStyle(wxLB_EXTENDED).withSelections({ 0, 2 })
+        }
+            .fitTo(&frame);
+        CHECK(frame.dump() == testDump(-1, { -1, -1 }, { -1, -1 }, wxLB_EXTENDED, 3, { 0, 2 }));
+    }
+
+    SECTION("pos")
+    {
+        TestParent frame;
+        wxUI::VSizer {
+            createUUT().withPosition({ 1, 2 })
+        }
+            .fitTo(&frame);
+        CHECK(frame.dump() == testDump(-1, { 1, 2 }, { -1, -1 }, 0, 3, {}));
+    }
+
+    COMMON_TESTS(VirtualListBoxTestPolicy)
+}
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers, readability-magic-numbers, readability-function-cognitive-complexity)